@@ -10,6 +10,8 @@
 #include "Actor.h"
 #include "Drawable.h"
 #include "Picture.h"
+#include <trace-api.h>
+#include <metrics-api.h>
 
 
 /**
@@ -19,6 +21,17 @@ Actor::Actor(const std::wstring &name) : mName(name)
 {
     // Set the channel name
     mChannel.SetName(name + L":position");
+
+    mMetricsPrefix = Metrics::UniquePrefix(L"actor/" + name);
+    mDrawMetric = Metrics::Get(mMetricsPrefix + L"draw");
+}
+
+/**
+ * Destructor
+ */
+Actor::~Actor()
+{
+    Metrics::Remove(mMetricsPrefix);
 }
 
 
@@ -29,23 +42,26 @@ Actor::Actor(const std::wstring &name) : mName(name)
 void Actor::SetRoot(std::shared_ptr<Drawable> root)
 {
    mRoot = root;
+   mPlacementOrder.clear();
 }
 
 /**
  * Draw this actor
  * @param graphics The Graphics object we are drawing on
  */
-void Actor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Actor::Draw(RenderContext &graphics)
 {
+    TRACE_ZONE("Actor::Draw");
+
     // Don't draw if not enabled
     if (!mEnabled)
         return;
 
-    // This takes care of determining the absolute placement
-    // of all of the child drawables. We have to determine this
-    // in tree order, which may not be the order we draw.
-    if (mRoot != nullptr)
-        mRoot->Place(mPosition, 0);
+    MetricTimer timer(mDrawMetric);
+
+    // Make sure the placement reflects any edits since
+    // the last time the drawables were placed.
+    UpdatePlacement();
 
     for (auto drawable : mDrawablesInOrder)
     {
@@ -86,6 +102,57 @@ void Actor::AddDrawable(std::shared_ptr<Drawable> drawable)
 {
     mDrawablesInOrder.push_back(drawable);
     drawable->SetActor(this);
+    mPlacementOrder.clear();
+}
+
+
+/**
+ * Determine the absolute placement of the drawables.
+ *
+ * This has to be done in tree order, which may not be the
+ * order we draw. Only drawables whose position or rotation
+ * changed, and their descendants, are recomputed.
+ * @return true if any drawable was placed
+ */
+bool Actor::UpdatePlacement()
+{
+    if (mRoot == nullptr)
+        return false;
+
+    if (mPlacementOrder.empty())
+    {
+        mRoot->AddToPlacementOrder(mPlacementOrder);
+        mRoot->MarkPlacementDirty();
+    }
+
+    if (mPosition != mPlacedPosition)
+    {
+        mPlacedPosition = mPosition;
+        mRoot->MarkPlacementDirty();
+    }
+
+    bool placed = false;
+    for (auto drawable : mPlacementOrder)
+    {
+        if (!drawable->IsPlacementDirty())
+            continue;
+
+        placed = true;
+        auto parent = drawable->GetParent();
+        if (parent == nullptr || drawable == mRoot.get())
+        {
+            drawable->Place(AffineTransform::Translation(mPosition.x, mPosition.y), 0);
+        }
+        else
+        {
+            drawable->Place(parent->GetPlacedTransform(), parent->GetPlacedRotation());
+        }
+    }
+
+    if (placed)
+        mPlacementVersion++;
+
+    return placed;
 }
 
 
@@ -12,6 +12,8 @@
 
 class Drawable;
 class Picture;
+class Metric;
+class RenderContext;
 
 /**
  * Class for actors in our drawings.
@@ -39,14 +41,30 @@ private:
     /// The drawables in drawing order
     std::vector<std::shared_ptr<Drawable>> mDrawablesInOrder;
 
+    /// The drawables in tree order, parents before children.
+    /// Rebuilt when empty.
+    std::vector<Drawable *> mPlacementOrder;
+
+    /// The actor position the root was last placed at
+    wxPoint mPlacedPosition;
+
+    /// Incremented whenever any drawable is placed
+    int mPlacementVersion = 0;
+
     /// The picture this actor is associated with
     Picture *mPicture = nullptr;
 
     /// The actor position channel
     AnimChannelPoint mChannel;
 
+    /// Start of the names of this actor's metrics
+    std::wstring mMetricsPrefix;
+
+    /// Time spent drawing this actor
+    Metric *mDrawMetric;
+
 public:
-    virtual ~Actor() {}
+    virtual ~Actor();
 
     Actor(const std::wstring &name);
 
@@ -58,9 +76,29 @@ public:
     void operator=(const Actor &) = delete;
 
     void SetRoot(std::shared_ptr<Drawable> root);
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics);
+    void Draw(RenderContext &graphics);
     std::shared_ptr<Drawable> HitTest(wxPoint pos);
     void AddDrawable(std::shared_ptr<Drawable> drawable);
+    bool UpdatePlacement();
+
+    /**
+     * Get a counter that changes whenever any drawable
+     * in this actor is placed somewhere new
+     * @return Placement version
+     */
+    int GetPlacementVersion() const { return mPlacementVersion; }
+
+    /**
+     * Get the drawables in drawing order
+     * @return Vector of drawables
+     */
+    const std::vector<std::shared_ptr<Drawable>> &GetDrawables() const { return mDrawablesInOrder; }
+
+    /**
+     * Indicate the drawable tree has changed, so the
+     * placement order must be rebuilt.
+     */
+    void InvalidatePlacementOrder() { mPlacementOrder.clear(); }
 
     /**
      * Get the actor name
@@ -0,0 +1,95 @@
+/**
+ * @file AffineTransform.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "AffineTransform.h"
+
+/**
+ * Constructor
+ * @param a x scale/rotation term
+ * @param b y shear/rotation term
+ * @param c x shear/rotation term
+ * @param d y scale/rotation term
+ * @param tx x translation
+ * @param ty y translation
+ */
+AffineTransform::AffineTransform(double a, double b, double c, double d, double tx, double ty) :
+        mA(a), mB(b), mC(c), mD(d), mTx(tx), mTy(ty)
+{
+}
+
+/**
+ * Create a transform that translates by some amount
+ * @param x Amount to translate in X
+ * @param y Amount to translate in Y
+ * @return Translation transform
+ */
+AffineTransform AffineTransform::Translation(double x, double y)
+{
+    return AffineTransform(1, 0, 0, 1, x, y);
+}
+
+/**
+ * Create a transform that rotates by an angle.
+ *
+ * This uses the same convention as the drawables, so it
+ * matches graphics->Rotate(-angle).
+ * @param angle Angle in radians
+ * @return Rotation transform
+ */
+AffineTransform AffineTransform::Rotation(double angle)
+{
+    double cs = cos(angle);
+    double sn = sin(angle);
+
+    return AffineTransform(cs, -sn, sn, cs, 0, 0);
+}
+
+/**
+ * Compose two transforms. The result applies other first,
+ * then this transform.
+ * @param other Transform to apply first
+ * @return Composed transform
+ */
+AffineTransform AffineTransform::operator*(const AffineTransform &other) const
+{
+    return AffineTransform(
+            mA * other.mA + mC * other.mB,
+            mB * other.mA + mD * other.mB,
+            mA * other.mC + mC * other.mD,
+            mB * other.mC + mD * other.mD,
+            mA * other.mTx + mC * other.mTy + mTx,
+            mB * other.mTx + mD * other.mTy + mTy);
+}
+
+/**
+ * Transform a point
+ * @param point Point to transform
+ * @return Transformed point
+ */
+wxPoint2DDouble AffineTransform::TransformPoint(const wxPoint2DDouble &point) const
+{
+    return wxPoint2DDouble(mA * point.m_x + mC * point.m_y + mTx,
+            mB * point.m_x + mD * point.m_y + mTy);
+}
+
+/**
+ * Transform a point by the inverse of this transform
+ * @param point Point to transform
+ * @return Point in the untransformed coordinate system
+ */
+wxPoint2DDouble AffineTransform::InverseTransformPoint(const wxPoint2DDouble &point) const
+{
+    double det = mA * mD - mB * mC;
+    if (det == 0)
+    {
+        return wxPoint2DDouble(0, 0);
+    }
+
+    double x = point.m_x - mTx;
+    double y = point.m_y - mTy;
+
+    return wxPoint2DDouble((mD * x - mC * y) / det, (mA * y - mB * x) / det);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file AffineTransform.h
+ * @author Mate Narh
+ *
+ * A two dimensional affine transformation in double precision.
+ */
+
+#ifndef CANADIANEXPERIENCE_AFFINETRANSFORM_H
+#define CANADIANEXPERIENCE_AFFINETRANSFORM_H
+
+/**
+ * A two dimensional affine transformation in double precision.
+ *
+ * A point (x, y) is transformed to (a*x + c*y + tx, b*x + d*y + ty),
+ * which is the same layout wxGraphicsMatrix uses.
+ */
+class AffineTransform {
+private:
+    double mA = 1;      ///< x scale/rotation term
+    double mB = 0;      ///< y shear/rotation term
+    double mC = 0;      ///< x shear/rotation term
+    double mD = 1;      ///< y scale/rotation term
+    double mTx = 0;     ///< x translation
+    double mTy = 0;     ///< y translation
+
+public:
+    /// Constructor, creates the identity transform
+    AffineTransform() {}
+
+    AffineTransform(double a, double b, double c, double d, double tx, double ty);
+
+    static AffineTransform Translation(double x, double y);
+    static AffineTransform Rotation(double angle);
+
+    AffineTransform operator*(const AffineTransform &other) const;
+
+    wxPoint2DDouble TransformPoint(const wxPoint2DDouble &point) const;
+    wxPoint2DDouble InverseTransformPoint(const wxPoint2DDouble &point) const;
+
+    /**
+     * Get the translation part of the transform. This is
+     * where the local origin ends up.
+     * @return Translation as a point
+     */
+    wxPoint2DDouble GetTranslation() const { return wxPoint2DDouble(mTx, mTy); }
+};
+
+#endif //CANADIANEXPERIENCE_AFFINETRANSFORM_H
@@ -56,28 +56,41 @@ void Drawable::SetKeyframe()
 void Drawable::GetKeyframe()
 {
     if (mChannel.IsValid())
-        mRotation = mChannel.GetAngle();
+    {
+        auto angle = mChannel.GetAngle();
+        if (angle != mRotation)
+        {
+            mRotation = angle;
+            mPlacementDirty = true;
+        }
+    }
 }
 
 
 /**
  * Place this drawable relative to its parent
  *
- * This works hierarchically from top item down.
- * @param offset Parent offset
- * @param rotate Parent rotation
+ * The parent must already be placed. Only this drawable
+ * is computed here. The children are marked as needing to
+ * be placed again, the actor takes care of placing them in
+ * tree order.
+ * @param parentTransform Transform from the parent to the drawing
+ * @param parentRotation Placed rotation of the parent
  */
-void Drawable::Place(wxPoint offset, double rotate)
+void Drawable::Place(const AffineTransform &parentTransform, double parentRotation)
 {
     // Combine the transformation we are given with the transformation
     // for this object.
-    mPlacedPosition = offset + RotatePoint(mPosition, rotate);
-    mPlacedR = mRotation + rotate;
-
-    // Update our children
-    for (auto drawable : mChildren)
+    mPlacedTransform = parentTransform *
+            AffineTransform::Translation(mPosition.x, mPosition.y) *
+            AffineTransform::Rotation(mRotation);
+    mPlacedPosition = mPlacedTransform.GetTranslation();
+    mPlacedR = mRotation + parentRotation;
+    mPlacementDirty = false;
+
+    for (auto &drawable : mChildren)
     {
-        drawable->Place(mPlacedPosition, mPlacedR);
+        drawable->mPlacementDirty = true;
     }
 }
 
@@ -91,6 +104,28 @@ void Drawable::AddChild(std::shared_ptr<Drawable> child)
     mChildren.push_back(child);
     child->mParent = this;
     child->SetParent(this);
+    child->mPlacementDirty = true;
+
+    // The tree has changed shape
+    if (mActor != nullptr)
+    {
+        mActor->InvalidatePlacementOrder();
+    }
+}
+
+
+/**
+ * Add this drawable and all of its descendants to a
+ * placement order. Parents always come before their children.
+ * @param order Vector to add the drawables to
+ */
+void Drawable::AddToPlacementOrder(std::vector<Drawable *> &order)
+{
+    order.push_back(this);
+    for (auto &drawable : mChildren)
+    {
+        drawable->AddToPlacementOrder(order);
+    }
 }
 
 
@@ -110,6 +145,30 @@ void Drawable::Move(wxPoint delta)
     {
         mPosition = mPosition + delta;
     }
+
+    mPlacementDirty = true;
+}
+
+
+/**
+ * Get the bounding box of this drawable in the drawing,
+ * based on the current placement.
+ * @return Bounding box, empty if the local bounds are not known
+ */
+wxRect2DDouble Drawable::GetPlacedBounds()
+{
+    auto local = GetLocalBounds();
+    if (local.IsEmpty())
+    {
+        return local;
+    }
+
+    auto p1 = mPlacedTransform.TransformPoint(local.GetLeftTop());
+    wxRect2DDouble bounds(p1.m_x, p1.m_y, 0, 0);
+    bounds.Union(mPlacedTransform.TransformPoint(wxPoint2DDouble(local.GetRight(), local.GetTop())));
+    bounds.Union(mPlacedTransform.TransformPoint(wxPoint2DDouble(local.GetLeft(), local.GetBottom())));
+    bounds.Union(mPlacedTransform.TransformPoint(local.GetRightBottom()));
+    return bounds;
 }
 
 
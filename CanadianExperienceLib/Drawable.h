@@ -10,6 +10,9 @@
 #define CANADIANEXPERIENCE_DRAWABLE_H
 
 #include "AnimChannelAngle.h"
+#include "AffineTransform.h"
+
+#include <render-api.h>
 
 class Actor;
 class Timeline;
@@ -43,13 +46,19 @@ private:
     /// The animation channel for animating the angle of this drawable
     AnimChannelAngle mChannel;
 
+    /// Does the placement need to be recomputed because
+    /// this drawable or its parent changed?
+    bool mPlacementDirty = true;
+
 protected:
     Drawable(const std::wstring &name);
     wxPoint RotatePoint(wxPoint point, double angle);
 
+    /// The transform from this drawable to the drawing
+    AffineTransform mPlacedTransform;
 
     /// The actual postion in the drawing
-    wxPoint mPlacedPosition = wxPoint(0, 0);
+    wxPoint2DDouble mPlacedPosition = wxPoint2DDouble(0, 0);
 
     /// The actual rotation in the drawing
     double mPlacedR = 0;
@@ -76,11 +85,35 @@ public:
      * Draw this drawable
      * @param graphics Graphics object to draw on
      */
-    virtual void Draw(std::shared_ptr<wxGraphicsContext> graphics) = 0;
+    virtual void Draw(RenderContext &graphics) = 0;
 
-    void Place(wxPoint offset, double rotate);
+    void Place(const AffineTransform &parentTransform, double parentRotation);
 
     void AddChild(std::shared_ptr<Drawable> child);
+    void AddToPlacementOrder(std::vector<Drawable *> &order);
+
+    /**
+     * Does this drawable need to be placed again?
+     * @return true if the placement is out of date
+     */
+    bool IsPlacementDirty() const { return mPlacementDirty; }
+
+    /**
+     * Indicate the placement of this drawable is out of date
+     */
+    void MarkPlacementDirty() { mPlacementDirty = true; }
+
+    /**
+     * Get the transform from this drawable to the drawing
+     * @return Placed transform
+     */
+    const AffineTransform &GetPlacedTransform() const { return mPlacedTransform; }
+
+    /**
+     * Get the actual rotation in the drawing
+     * @return Placed rotation in radians
+     */
+    double GetPlacedRotation() const { return mPlacedR; }
 
     /**
      * Display the machine selection dialog box
@@ -119,6 +152,16 @@ public:
      */
     virtual bool HitTest(wxPoint pos) = 0;
 
+    /**
+     * Get the bounding box of this drawable in its local
+     * coordinates. An empty box means the bounds are not known,
+     * so the drawable is hit tested everywhere.
+     * @return Local bounding box
+     */
+    virtual wxRect2DDouble GetLocalBounds() { return wxRect2DDouble(); }
+
+    wxRect2DDouble GetPlacedBounds();
+
     /**
      * Is this a movable drawable?
      * @return true if movable
@@ -131,7 +174,7 @@ public:
      * Set the drawable position
      * @param pos The new drawable position
      */
-    virtual void SetPosition(wxPoint pos) { mPosition = pos; } // virtualized
+    virtual void SetPosition(wxPoint pos) { mPosition = pos; mPlacementDirty = true; } // virtualized
 
     /**
      * Get the drawable position
@@ -143,7 +186,7 @@ public:
      * Set the rotation angle in radians
     * @param r The new rotation angle in radians
      */
-    void SetRotation(double r) { mRotation = r; }
+    void SetRotation(double r) { mRotation = r; mPlacementDirty = true; }
 
     /**
      * Get the rotation angle in radians
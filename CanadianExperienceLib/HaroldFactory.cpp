@@ -10,6 +10,24 @@
 #include "ImageDrawable.h"
 #include "HeadTop.h"
 
+/// Image file for Harold's shirt
+const std::wstring ShirtImage = L"/harold_shirt.png";
+
+/// Image file for Harold's vest
+const std::wstring VestImage = L"/harold_vest.png";
+
+/// Image file for Harold's left leg
+const std::wstring LeftLegImage = L"/harold_lleg.png";
+
+/// Image file for Harold's right leg
+const std::wstring RightLegImage = L"/harold_rleg.png";
+
+/// Image file for Harold's head bottom
+const std::wstring HeadBottomImage = L"/harold_headb.png";
+
+/// Image file for Harold's head top
+const std::wstring HeadTopImage = L"/harold_headt_blank.png";
+
 
 
 /**
@@ -21,31 +39,31 @@ std::shared_ptr<Actor> HaroldFactory::Create(std::wstring imagesDir)
 {
     std::shared_ptr<Actor> actor = std::make_shared<Actor>(L"Harold");
 
-    auto shirt = std::make_shared<ImageDrawable>(L"Shirt", imagesDir + L"/harold_shirt.png");
+    auto shirt = std::make_shared<ImageDrawable>(L"Shirt", imagesDir + ShirtImage);
     shirt->SetCenter(wxPoint(44, 138));
     shirt->SetPosition(wxPoint(0, -114));
     actor->SetRoot(shirt);
 
-    auto vest = std::make_shared<ImageDrawable>(L"Vest", imagesDir + L"/harold_vest.png");
+    auto vest = std::make_shared<ImageDrawable>(L"Vest", imagesDir + VestImage);
     vest->SetCenter(wxPoint(44, 138));
     shirt->AddChild(vest);
 
-    auto lleg = std::make_shared<ImageDrawable>(L"Left Leg", imagesDir + L"/harold_lleg.png");
+    auto lleg = std::make_shared<ImageDrawable>(L"Left Leg", imagesDir + LeftLegImage);
     lleg->SetCenter(wxPoint(11, 9));
     lleg->SetPosition(wxPoint(27, 0));
     shirt->AddChild(lleg);
 
-    auto rleg = std::make_shared<ImageDrawable>(L"Right Leg", imagesDir + L"/harold_rleg.png");
+    auto rleg = std::make_shared<ImageDrawable>(L"Right Leg", imagesDir + RightLegImage);
     rleg->SetCenter(wxPoint(39, 9));
     rleg->SetPosition(wxPoint(-27, 0));
     shirt->AddChild(rleg);
 
-    auto headb = std::make_shared<ImageDrawable>(L"Head Bottom", imagesDir + L"/harold_headb.png");
+    auto headb = std::make_shared<ImageDrawable>(L"Head Bottom", imagesDir + HeadBottomImage);
     headb->SetCenter(wxPoint(44, 31));
     headb->SetPosition(wxPoint(0, -130));
     shirt->AddChild(headb);
 
-    auto headt = std::make_shared<HeadTop>(L"Head Top", imagesDir + L"/harold_headt_blank.png");
+    auto headt = std::make_shared<HeadTop>(L"Head Top", imagesDir + HeadTopImage);
     headt->SetCenter(wxPoint(55, 109));
     headt->SetPosition(wxPoint(0, -31));
     headb->AddChild(headt);
@@ -100,4 +118,19 @@ std::shared_ptr<Actor> HaroldFactory::Create(std::wstring imagesDir)
     actor->AddDrawable(headt);
 
     return actor;
-}
\ No newline at end of file
+}
+
+/**
+ * Get the image files the actor this factory creates uses
+ * @param imagesDir Directory that contains the images for this application
+ * @return Image filenames, named the same way Create loads them
+ */
+std::vector<std::wstring> HaroldFactory::GetImages(std::wstring imagesDir)
+{
+    return {imagesDir + ShirtImage,
+            imagesDir + VestImage,
+            imagesDir + LeftLegImage,
+            imagesDir + RightLegImage,
+            imagesDir + HeadBottomImage,
+            imagesDir + HeadTopImage};
+}
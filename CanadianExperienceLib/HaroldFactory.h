@@ -19,6 +19,7 @@ private:
 public:
 
     std::shared_ptr<Actor> Create(std::wstring imagesDir);
+    std::vector<std::wstring> GetImages(std::wstring imagesDir);
 };
 
 #endif //CANADIANEXPERIENCE_HAROLDFACTORY_H
@@ -78,7 +78,7 @@ void HeadTop::GetKeyframe()
  * Draw the head top
  * @param graphics
  */
-void HeadTop::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void HeadTop::Draw(RenderContext &graphics)
 {
     ImageDrawable::Draw(graphics);
 
@@ -115,13 +115,13 @@ void HeadTop::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     if (mLeftEye.IsLoaded() && mRightEye.IsLoaded())
     {
         // Determine the point on the screen were we will draw the left eye
-        wxPoint leye = TransformPoint(wxPoint(leftX, eyeY));
+        auto leye = TransformPoint(wxPoint(leftX, eyeY));
         // And draw the bitmap there
-        mLeftEye.DrawImage(graphics, leye, mPlacedR);
+        mLeftEye.DrawImage(graphics.GetGraphics(), leye, mPlacedR);
 
         // Repeat the process for the right eye.
-        wxPoint reye = TransformPoint(wxPoint(rightX, eyeY));
-        mRightEye.DrawImage(graphics, reye, mPlacedR);
+        auto reye = TransformPoint(wxPoint(rightX, eyeY));
+        mRightEye.DrawImage(graphics.GetGraphics(), reye, mPlacedR);
     }
     else
     {
@@ -144,15 +144,14 @@ void HeadTop::Draw(std::shared_ptr<wxGraphicsContext> graphics)
  * @param p1 First point
  * @param p2 Second point
  */
-void HeadTop::DrawEyebrow(std::shared_ptr<wxGraphicsContext> graphics,
+void HeadTop::DrawEyebrow(RenderContext &graphics,
         wxPoint p1, wxPoint p2)
 {
     auto eb1 = TransformPoint(p1);
     auto eb2 = TransformPoint(p2);
 
-    wxPen eyebrowPen(*wxBLACK, 2);
-    graphics->SetPen(eyebrowPen);
-    graphics->StrokeLine(eb1.x, eb1.y, eb2.x, eb2.y);
+    graphics.SetPen(*wxBLACK, 2);
+    graphics->StrokeLine(eb1.m_x, eb1.m_y, eb2.m_x, eb2.m_y);
 }
 
 
@@ -160,10 +159,10 @@ void HeadTop::DrawEyebrow(std::shared_ptr<wxGraphicsContext> graphics,
  * Draw an eye using an Ellipse
  * @param graphics The graphics context to draw on
  * @param p1 Where to draw before transformation */
-void HeadTop::DrawEye(std::shared_ptr<wxGraphicsContext> graphics, wxPoint p1)
+void HeadTop::DrawEye(RenderContext &graphics, wxPoint p1)
 {
-    graphics->SetBrush(*wxBLACK_BRUSH);
-    graphics->SetPen(*wxTRANSPARENT_PEN);
+    graphics.SetBrush(*wxBLACK);
+    graphics.SetTransparentPen();
 
     auto e1 = TransformPoint(p1);
 
@@ -171,7 +170,7 @@ void HeadTop::DrawEye(std::shared_ptr<wxGraphicsContext> graphics, wxPoint p1)
     float hit = 20.0f;
 
     graphics->PushState();
-    graphics->Translate(e1.x, e1.y);
+    graphics->Translate(e1.m_x, e1.m_y);
     graphics->Rotate(-mPlacedR);
     graphics->DrawEllipse(-wid/2, -hit/2, wid, hit);
     graphics->PopState();
@@ -183,11 +182,11 @@ void HeadTop::DrawEye(std::shared_ptr<wxGraphicsContext> graphics, wxPoint p1)
 * @param  p Point to transform
 * @returns Transformed point
 */
-wxPoint HeadTop::TransformPoint(wxPoint p)
+wxPoint2DDouble HeadTop::TransformPoint(wxPoint p)
 {
     // Make p relative to the image center
     p = p - GetCenter();
 
     // Rotate as needed and offset
-    return RotatePoint(p, mPlacedR) + mPlacedPosition;
+    return mPlacedTransform.TransformPoint(wxPoint2DDouble(p.x, p.y));
 }
@@ -0,0 +1,116 @@
+/**
+ * @file ImageData.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <image-cache-api.h>
+#include "ImageData.h"
+
+/// Number of bits in a mask word
+const int MaskWordBits = 32;
+
+/**
+ * Constructor, loads the image from a file.
+ *
+ * The decoded image comes from the image cache, so files
+ * preloaded at startup are not decoded again.
+ * @param filename File to load
+ */
+ImageData::ImageData(const std::wstring &filename)
+{
+    auto image = ImageCache::Get(filename);
+    if (image != nullptr)
+    {
+        mImage = *image;
+    }
+
+    BuildMask();
+}
+
+/**
+ * Constructor, uses an image that has already been decoded
+ * @param image Image to use
+ */
+ImageData::ImageData(const wxImage &image) : mImage(image)
+{
+    BuildMask();
+}
+
+/**
+ * Build the coverage mask from the alpha channel or
+ * mask color of the image.
+ *
+ * A pixel is covered if it would not be reported as
+ * transparent by wxImage::IsTransparent.
+ */
+void ImageData::BuildMask()
+{
+    mMask.clear();
+    mMaskStride = 0;
+
+    if (!mImage.IsOk() || (!mImage.HasAlpha() && !mImage.HasMask()))
+    {
+        // Every pixel is drawn, no mask is needed
+        return;
+    }
+
+    int wid = mImage.GetWidth();
+    int hit = mImage.GetHeight();
+    mMaskStride = (wid + MaskWordBits - 1) / MaskWordBits;
+    mMask.assign(size_t(mMaskStride) * hit, 0);
+
+    const unsigned char *alpha = mImage.HasAlpha() ? mImage.GetAlpha() : nullptr;
+    const unsigned char *rgb = mImage.GetData();
+    bool hasMask = mImage.HasMask();
+    unsigned char maskR = hasMask ? mImage.GetMaskRed() : 0;
+    unsigned char maskG = hasMask ? mImage.GetMaskGreen() : 0;
+    unsigned char maskB = hasMask ? mImage.GetMaskBlue() : 0;
+
+    for (int y = 0; y < hit; y++)
+    {
+        uint32_t *row = &mMask[size_t(y) * mMaskStride];
+        for (int x = 0; x < wid; x++)
+        {
+            size_t pixel = size_t(y) * wid + x;
+            bool covered = true;
+
+            if (alpha != nullptr && alpha[pixel] < wxIMAGE_ALPHA_THRESHOLD)
+            {
+                covered = false;
+            }
+            else if (hasMask && rgb[pixel * 3] == maskR &&
+                    rgb[pixel * 3 + 1] == maskG && rgb[pixel * 3 + 2] == maskB)
+            {
+                covered = false;
+            }
+
+            if (covered)
+            {
+                row[x / MaskWordBits] |= uint32_t(1) << (x % MaskWordBits);
+            }
+        }
+    }
+}
+
+/**
+ * Is a pixel of the image drawn?
+ * @param x X location in pixels
+ * @param y Y location in pixels
+ * @return true if the pixel is inside the image and not transparent
+ */
+bool ImageData::IsCovered(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= GetWidth() || y >= GetHeight())
+    {
+        return false;
+    }
+
+    if (mMask.empty())
+    {
+        return true;
+    }
+
+    uint32_t word = mMask[size_t(y) * mMaskStride + x / MaskWordBits];
+    return (word >> (x % MaskWordBits)) & 1;
+}
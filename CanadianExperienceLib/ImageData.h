@@ -0,0 +1,66 @@
+/**
+ * @file ImageData.h
+ * @author Mate Narh
+ *
+ * A decoded image and its coverage mask, shared by the drawables that use it.
+ */
+
+#ifndef CANADIANEXPERIENCE_IMAGEDATA_H
+#define CANADIANEXPERIENCE_IMAGEDATA_H
+
+/**
+ * A decoded image and its coverage mask, shared by the drawables that use it.
+ *
+ * The coverage mask has one bit per pixel that is set if the pixel
+ * is drawn. It is built once when the image is created, so testing
+ * a pixel does not need to look at the alpha channel.
+ */
+class ImageData {
+private:
+    /// The decoded image
+    wxImage mImage;
+
+    /// One bit per pixel, set if the pixel is drawn. Each row
+    /// starts on a new word. Empty if every pixel is drawn.
+    std::vector<uint32_t> mMask;
+
+    /// Number of mask words in each row
+    int mMaskStride = 0;
+
+    void BuildMask();
+
+public:
+    ImageData(const std::wstring &filename);
+    ImageData(const wxImage &image);
+
+    /// Default constructor (disabled)
+    ImageData() = delete;
+
+    /// Copy constructor (disabled)
+    ImageData(const ImageData &) = delete;
+
+    /// Assignment operator
+    void operator=(const ImageData &) = delete;
+
+    /**
+     * Get the decoded image
+     * @return Image
+     */
+    const wxImage &GetImage() const { return mImage; }
+
+    /**
+     * Get the image width
+     * @return Width in pixels
+     */
+    int GetWidth() const { return mImage.IsOk() ? mImage.GetWidth() : 0; }
+
+    /**
+     * Get the image height
+     * @return Height in pixels
+     */
+    int GetHeight() const { return mImage.IsOk() ? mImage.GetHeight() : 0; }
+
+    bool IsCovered(int x, int y) const;
+};
+
+#endif //CANADIANEXPERIENCE_IMAGEDATA_H
@@ -5,6 +5,7 @@
 
 #include "pch.h"
 #include "ImageDrawable.h"
+#include "ImageData.h"
 
 
 /** Constructor
@@ -13,7 +14,16 @@
 ImageDrawable::ImageDrawable(const std::wstring &name, const std::wstring &filename) :
         Drawable(name)
 {
-    mImage = std::make_unique<wxImage>(filename, wxBITMAP_TYPE_ANY);
+    mImageData = std::make_shared<ImageData>(filename);
+}
+
+
+/** Constructor
+ * @param name The drawable name
+ * @param imageData Image that has already been loaded */
+ImageDrawable::ImageDrawable(const std::wstring &name, std::shared_ptr<ImageData> imageData) :
+        Drawable(name), mImageData(imageData)
+{
 }
 
 
@@ -21,18 +31,18 @@ ImageDrawable::ImageDrawable(const std::wstring &name, const std::wstring &filen
  * Draw the image drawable
  * @param graphics Graphics context to draw on
  */
-void ImageDrawable::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void ImageDrawable::Draw(RenderContext &graphics)
 {
     if(mBitmap.IsNull())
     {
-        mBitmap = graphics->CreateBitmapFromImage(*mImage);
+        mBitmap = graphics->CreateBitmapFromImage(mImageData->GetImage());
     }
 
     graphics->PushState();
-    graphics->Translate(mPlacedPosition.x, mPlacedPosition.y);
+    graphics->Translate(mPlacedPosition.m_x, mPlacedPosition.m_y);
     graphics->Rotate(-mPlacedR);
     graphics->DrawBitmap(mBitmap, -mCenter.x, -mCenter.y,
-            mImage->GetWidth(), mImage->GetHeight());
+            mImageData->GetWidth(), mImageData->GetHeight());
 
     graphics->PopState();
 }
@@ -45,46 +55,22 @@ void ImageDrawable::Draw(std::shared_ptr<wxGraphicsContext> graphics)
  */
 bool ImageDrawable::HitTest(wxPoint pos)
 {
-    double x = pos.x;
-    double y = pos.y;
-
-    // Translate(-mPlacedPosition)
-    x -= mPlacedPosition.x;
-    y -= mPlacedPosition.y;
-
-    double sn = sin(mPlacedR);
-    double cs = cos(mPlacedR);
-
-    // Rotate(mPlacedR)
-    double x1 = cs * x - sn * y;
-    double y1 = sn * x + cs * y;
-
-    // Translate(mCenter)
-    x = x1 + mCenter.x;
-    y = y1 + mCenter.y;
-
-
-//    wxGraphicsMatrix mat;
-//    mat.Translate(mCenter.x, mCenter.y);
-//    mat.Rotate(mPlacedR);
-//    mat.Translate(-mPlacedPosition.x, -mPlacedPosition.y);
-//
-//    wxDouble x = pos.x;
-//    wxDouble y = pos.y;
-//    mat.TransformPoint(&x, &y);
-
-    double wid = mImage->GetWidth();
-    double hit = mImage->GetHeight();
+    // Transform the click back into image coordinates
+    auto local = mPlacedTransform.InverseTransformPoint(wxPoint2DDouble(pos.x, pos.y));
+    double x = local.m_x + mCenter.x;
+    double y = local.m_y + mCenter.y;
+
+    // Only the drawn part of the image is hit. The coverage
+    // mask is false outside the image.
+    return mImageData->IsCovered((int)floor(x), (int)floor(y));
+}
 
-    // Test to see if x, y are in the image
-    if (x < 0 || y < 0 || x >= wid || y >= hit)
-    {
-        // We are outside the image
-        return false;
-    }
 
-    // Test to see if x, y are in the drawn part of the image
-    // If the location is transparent, we are not in the drawn
-    // part of the image
-    return !mImage->IsTransparent((int)x, (int)y);
-}
\ No newline at end of file
+/**
+ * Get the bounding box of the image in local coordinates
+ * @return Local bounding box
+ */
+wxRect2DDouble ImageDrawable::GetLocalBounds()
+{
+    return wxRect2DDouble(-mCenter.x, -mCenter.y, mImageData->GetWidth(), mImageData->GetHeight());
+}
@@ -10,13 +10,16 @@
 
 #include "Drawable.h"
 
+class ImageData;
+
 /**
  * A drawable that displays an image
  */
 class ImageDrawable : public Drawable {
 private:
-    /// The underlying image we are drawing
-    std::unique_ptr<wxImage> mImage;
+    /// The underlying image we are drawing, which
+    /// may be shared with other drawables
+    std::shared_ptr<ImageData> mImageData;
 
     /// The graphics bitmap we will use
     wxGraphicsBitmap mBitmap;
@@ -26,12 +29,13 @@ private:
 
 public:
     ImageDrawable(const std::wstring& name, const std::wstring& filename);
+    ImageDrawable(const std::wstring& name, std::shared_ptr<ImageData> imageData);
 
     /**
      * Set the center to rotate around
      * @param center New center
      */
-    void SetCenter(wxPoint center) { mCenter = center; }
+    void SetCenter(wxPoint center) { mCenter = center; MarkPlacementDirty(); }
 
     /**
      * Get the center to rotate around
@@ -39,9 +43,10 @@ public:
      */
     wxPoint GetCenter() const { return mCenter; }
 
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
 
     bool HitTest(wxPoint pos) override;
+    wxRect2DDouble GetLocalBounds() override;
 };
 
 #endif //CANADIANEXPERIENCE_IMAGEDRAWABLE_H
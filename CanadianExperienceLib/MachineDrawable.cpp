@@ -4,6 +4,7 @@
  */
 
 #include "pch.h"
+#include <machine-system-api.h>
 #include "MachineDrawable.h"
 #include "Actor.h"
 #include "Picture.h"
@@ -17,6 +18,14 @@ MachineDrawable::MachineDrawable(const std::wstring &name, const std::wstring &r
 {
     MachineSystemFactory factory(resourcesDir);
     mMachineSystem = factory.CreateMachineSystem();
+
+    // Record the machine's metrics under our name, so the
+    // performance overlay shows which machine they are for
+    auto machineSystem = std::dynamic_pointer_cast<MachineSystem>(mMachineSystem);
+    if (machineSystem != nullptr)
+    {
+        machineSystem->SetMetricsName(name);
+    }
 }
 
 
@@ -24,18 +33,20 @@ MachineDrawable::MachineDrawable(const std::wstring &name, const std::wstring &r
  * Draw the machine system encapsulated in this drawable
  * @param graphics The graphics context object to draw on
  */
-void MachineDrawable::Draw(std::shared_ptr <wxGraphicsContext> graphics)
+void MachineDrawable::Draw(RenderContext &graphics)
 {
     Run();
 
     double scale = 0.75f;
 
     graphics->PushState();
-    graphics->Translate(mPlacedPosition.x, mPlacedPosition.y);
+    graphics->Translate(mPlacedPosition.m_x, mPlacedPosition.m_y);
     graphics->Scale(scale, scale);
-    graphics->SetInterpolationQuality(wxINTERPOLATION_BEST);
+    // Polygon picks the mip level closest to the drawn size, so
+    // bilinear filtering is enough to finish the scaling
+    graphics->SetInterpolationQuality(wxINTERPOLATION_GOOD);
     mMachineSystem->SetLocation(wxPoint(0, 0));
-    mMachineSystem->DrawMachine(graphics);
+    mMachineSystem->DrawMachine(graphics.GetGraphics());
     graphics->PopState();
 }
 
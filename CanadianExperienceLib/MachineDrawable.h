@@ -35,7 +35,7 @@ public:
     void XmlSave(wxXmlNode *node) override;
     void XmlLoad(wxXmlNode *node) override;
     void DoDialog(wxWindow *parent) override;
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
 
     void SetPosition(wxPoint pos) override;
     void SetStartTime(double time) override;
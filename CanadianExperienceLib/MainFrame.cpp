@@ -7,6 +7,7 @@
 
 #include <wx/xrc/xmlres.h>
 #include <wx/stdpaths.h>
+#include <wx/stopwatch.h>
 
 #include "MainFrame.h"
 
@@ -14,10 +15,17 @@
 #include "ViewTimeline.h"
 #include "Picture.h"
 #include "PictureFactory.h"
+#include <trace-api.h>
+#include <render-api.h>
+#include <sprite-atlas-api.h>
 
 /// Directory within resources that contains the images.
 const std::wstring ImagesDirectory = L"/images";
 
+/// Environment variable naming a file to trace into. If it
+/// is set, tracing starts right away and is saved on exit.
+const std::wstring TraceEnvironmentVariable = L"CANADIAN_EXPERIENCE_TRACE";
+
 
 /**
  * Constructor
@@ -36,6 +44,11 @@ MainFrame::MainFrame(std::wstring resourcesDir) :
  */
 void MainFrame::Initialize()
 {
+    if (wxGetEnv(TraceEnvironmentVariable, &mTraceFile) && !mTraceFile.empty())
+    {
+        Tracer::SetEnabled(true);
+    }
+
     wxXmlResource::Get()->LoadFrame(this, nullptr, L"MainFrame");
 #ifdef WIN32
     SetIcon(wxIcon(L"mainframe", wxBITMAP_TYPE_ICO_RESOURCE));
@@ -57,13 +70,19 @@ void MainFrame::Initialize()
     Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnExit, this, wxID_EXIT);
     Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnAbout, this, wxID_ABOUT);
     Bind(wxEVT_CLOSE_WINDOW, &MainFrame::OnClose, this);
+    Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnFileTrace, this, XRCID("FileTrace"));
+    Bind(wxEVT_UPDATE_UI, &MainFrame::OnUpdateFileTrace, this, XRCID("FileTrace"));
+    Bind(wxEVT_COMMAND_MENU_SELECTED, &MainFrame::OnFileSaveTrace, this, XRCID("FileSaveTrace"));
 
     //
-    // Create the picture
+    // Create the picture, timing how long it takes
+    // since that is most of our startup time
     //
+    wxStopWatch loadTime;
     PictureFactory factory;
     mPicture = factory.Create(mResourcesDir);
     mPicture->SetParent(this); // Set the parent of this picture
+    SetStatusText(wxString::Format(L"Picture loaded in %ld ms", loadTime.Time()));
 
     // Tell the views about the picture
     mViewEdit->SetPicture(mPicture);
@@ -100,7 +119,66 @@ void MainFrame::OnAbout(wxCommandEvent& event)
 void MainFrame::OnClose(wxCloseEvent& event)
 {
     mViewTimeline->Stop();
+
+    if (!mTraceFile.empty())
+    {
+        Tracer::Save(mTraceFile.ToStdWstring());
+    }
+
+    // Release cached graphics objects while the renderer still exists
+    RenderContext::Clear();
+    SpriteAtlas::Clear();
+
     Destroy();
 }
 
+/**
+ * File>Record Trace menu handler, turns tracing on or off
+ * @param event The menu command event
+ */
+void MainFrame::OnFileTrace(wxCommandEvent& event)
+{
+    if (Tracer::IsEnabled())
+    {
+        Tracer::SetEnabled(false);
+    }
+    else
+    {
+        // Each recording starts with empty buffers
+        Tracer::Clear();
+        Tracer::SetEnabled(true);
+    }
+}
+
+/**
+ * Update the user interface for File>Record Trace
+ * @param event The event we update
+ */
+void MainFrame::OnUpdateFileTrace(wxUpdateUIEvent& event)
+{
+    event.Check(Tracer::IsEnabled());
+}
+
+/**
+ * File>Save Trace menu handler
+ * @param event The menu command event
+ */
+void MainFrame::OnFileSaveTrace(wxCommandEvent& event)
+{
+    wxFileDialog saveFileDialog(this, _("Save Trace file"), "", "",
+            "Trace Files (*.json)|*.json", wxFD_SAVE|wxFD_OVERWRITE_PROMPT);
+    if (saveFileDialog.ShowModal() == wxID_CANCEL)
+    {
+        return;
+    }
+
+    if (!Tracer::Save(saveFileDialog.GetPath().ToStdWstring()))
+    {
+        wxMessageBox(L"Unable to save the trace file", L"Save Trace");
+        return;
+    }
+
+    SetStatusText(wxString::Format(L"Trace saved, %zu events dropped", Tracer::GetDropped()));
+}
+
 
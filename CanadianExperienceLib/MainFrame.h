@@ -26,6 +26,9 @@ private:
     void OnExit(wxCommandEvent& event);
     void OnAbout(wxCommandEvent&);
     void OnClose(wxCloseEvent &event);
+    void OnFileTrace(wxCommandEvent& event);
+    void OnUpdateFileTrace(wxUpdateUIEvent& event);
+    void OnFileSaveTrace(wxCommandEvent& event);
 
     /// The resources directory to use
     std::wstring mResourcesDir;
@@ -33,6 +36,9 @@ private:
     /// The picture object we are viewing/editing
     std::shared_ptr<Picture> mPicture;
 
+    /// File to save the trace to on exit, empty if none
+    wxString mTraceFile;
+
 public:
     MainFrame(std::wstring resourcesDir);
 
@@ -0,0 +1,152 @@
+/**
+ * @file PerformanceHud.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <metrics-api.h>
+#include <render-api.h>
+#include "PerformanceHud.h"
+
+/// Width of the overlay in pixels
+const double HudWidth = 400;
+
+/// Space around the overlay contents in pixels
+const double HudMargin = 8;
+
+/// Height of a line of text in pixels
+const double LineHeight = 16;
+
+/// Height of the frame rate graph in pixels
+const double GraphHeight = 60;
+
+/// Frame rate at the top of the graph
+const double GraphMaxFps = 120;
+
+/// Frame rate we want to hold, marked on the graph
+const double TargetFps = 30;
+
+/**
+ * Constructor
+ */
+PerformanceHud::PerformanceHud()
+{
+    mFrameMetric = Metrics::Get(L"frame/draw");
+    mIntervalMetric = Metrics::Get(L"frame/interval");
+}
+
+/**
+ * Call when the view starts drawing a frame
+ */
+void PerformanceHud::FrameBegin()
+{
+    mFrameStart = MetricTimer::Now();
+    if (mLastFrameStart >= 0)
+    {
+        mIntervalMetric->Record(mFrameStart - mLastFrameStart);
+    }
+
+    mLastFrameStart = mFrameStart;
+}
+
+/**
+ * Call when the view has drawn a frame, before
+ * drawing the overlay itself
+ */
+void PerformanceHud::FrameEnd()
+{
+    mFrameMetric->Record(MetricTimer::Now() - mFrameStart);
+}
+
+/**
+ * Draw the overlay if it is visible
+ * @param graphics Graphics context to draw on
+ * @param position Top left corner of the overlay
+ */
+void PerformanceHud::Draw(RenderContext &graphics, wxPoint position)
+{
+    if (!mVisible)
+    {
+        return;
+    }
+
+    // Everything under actor/ and machine/, in name order
+    auto metrics = Metrics::Find(L"actor/");
+    auto machines = Metrics::Find(L"machine/");
+    metrics.insert(metrics.end(), machines.begin(), machines.end());
+
+    double interval = mIntervalMetric->GetAverage();
+    double fps = interval > 0 ? 1000 / interval : 0;
+
+    double height = HudMargin * 2 + LineHeight + GraphHeight + HudMargin + LineHeight * metrics.size();
+    graphics.SetTransparentPen();
+    graphics.SetBrush(wxColour(0, 0, 0, 180));
+    graphics->DrawRectangle(position.x, position.y, HudWidth, height);
+
+    graphics.SetFont(12, *wxWHITE, wxFONTFAMILY_MODERN);
+
+    double x = position.x + HudMargin;
+    double y = position.y + HudMargin;
+    graphics->DrawText(wxString::Format(L"frame %.1f ms (max %.1f)  %.0f fps",
+            mFrameMetric->GetLast(), mFrameMetric->GetMax(), fps), x, y);
+    y += LineHeight;
+
+    DrawGraph(graphics, x, y);
+    y += GraphHeight + HudMargin;
+
+    for (auto metric : metrics)
+    {
+        // Step counts are whole numbers
+        const wchar_t *format = metric->GetUnit() == L"ms" ? L"%-32ls %7.2f %ls (avg %.2f)" : L"%-32ls %7.0f %ls";
+        graphics->DrawText(wxString::Format(format, metric->GetName().c_str(), metric->GetLast(),
+                metric->GetUnit().c_str(), metric->GetAverage()), x, y);
+        y += LineHeight;
+    }
+}
+
+/**
+ * Draw the graph of recent frame rates
+ * @param graphics Graphics context to draw on
+ * @param x Left of the graph
+ * @param y Top of the graph
+ */
+void PerformanceHud::DrawGraph(RenderContext &graphics, double x, double y)
+{
+    double width = HudWidth - HudMargin * 2;
+    double bottom = y + GraphHeight;
+
+    graphics.SetBrush(wxColour(255, 255, 255, 40));
+    graphics->DrawRectangle(x, y, width, GraphHeight);
+
+    // The target frame rate
+    double target = bottom - GraphHeight * TargetFps / GraphMaxFps;
+    graphics.SetPen(wxColour(255, 200, 0));
+    graphics->StrokeLine(x, target, x + width, target);
+
+    int num = mIntervalMetric->GetNumSamples();
+    if (num < 2)
+    {
+        return;
+    }
+
+    auto path = graphics->CreatePath();
+    double step = width / (Metric::HistorySize - 1);
+    for (int i = 0; i < num; i++)
+    {
+        double interval = mIntervalMetric->GetSample(i);
+        double fps = interval > 0 ? std::min(1000 / interval, GraphMaxFps) : GraphMaxFps;
+        double px = x + width - (num - 1 - i) * step;
+        double py = bottom - GraphHeight * fps / GraphMaxFps;
+        if (i == 0)
+        {
+            path.MoveToPoint(px, py);
+        }
+        else
+        {
+            path.AddLineToPoint(px, py);
+        }
+    }
+
+    graphics.SetPen(wxColour(0, 255, 0));
+    graphics->StrokePath(path);
+}
@@ -0,0 +1,67 @@
+/**
+ * @file PerformanceHud.h
+ * @author Mate Narh
+ *
+ * Overlay that shows live performance metrics.
+ */
+
+#ifndef CANADIANEXPERIENCE_PERFORMANCEHUD_H
+#define CANADIANEXPERIENCE_PERFORMANCEHUD_H
+
+class Metric;
+class RenderContext;
+
+/**
+ * Overlay that shows live performance metrics.
+ *
+ * Shows the frame time and a graph of recent frame rates
+ * for the view that owns it, then every actor and machine
+ * metric in the Metrics registry. Frames are timed even while
+ * the overlay is hidden, so it has history as soon as it is shown.
+ */
+class PerformanceHud {
+private:
+    /// Is the overlay drawn?
+    bool mVisible = false;
+
+    /// Time to draw each frame
+    Metric *mFrameMetric;
+
+    /// Time between the starts of frames
+    Metric *mIntervalMetric;
+
+    /// When the current frame started in milliseconds
+    double mFrameStart = 0;
+
+    /// When the previous frame started in milliseconds, negative if none
+    double mLastFrameStart = -1;
+
+    void DrawGraph(RenderContext &graphics, double x, double y);
+
+public:
+    PerformanceHud();
+
+    /// Copy constructor (disabled)
+    PerformanceHud(const PerformanceHud &) = delete;
+
+    /// Assignment operator
+    void operator=(const PerformanceHud &) = delete;
+
+    void FrameBegin();
+    void FrameEnd();
+    void Draw(RenderContext &graphics, wxPoint position);
+
+    /**
+     * Is the overlay drawn?
+     * @return true if visible
+     */
+    bool IsVisible() const { return mVisible; }
+
+    /**
+     * Show or hide the overlay
+     * @param visible If true, the overlay is drawn
+     */
+    void SetVisible(bool visible) { mVisible = visible; }
+};
+
+#endif //CANADIANEXPERIENCE_PERFORMANCEHUD_H
@@ -11,12 +11,21 @@
 #include "Picture.h"
 #include "PictureObserver.h"
 #include "Actor.h"
+#include "Drawable.h"
 #include "StartTimeDlg.h"
+#include <trace-api.h>
+
+/// Size of a hit test grid cell in pixels
+const double HitGridCellSize = 64;
+
+/// Shortest time between update deliveries in milliseconds,
+/// which is one frame of a 60Hz display
+const long UpdateInterval = 16;
 
 /**
  * Constructor
 */
-Picture::Picture()
+Picture::Picture() : mHitGrid(HitGridCellSize)
 {
 }
 
@@ -31,12 +40,14 @@ Picture::Picture()
 void Picture::SetAnimationTime(double time)
 {
     mTimeline.SetCurrentTime(time);
-    UpdateObservers();
 
     for (auto actor : mActors)
     {
         actor->GetKeyframe();
+        actor->UpdatePlacement();
     }
+
+    PostUpdate(TimeChanged);
 }
 
 /**
@@ -75,18 +86,88 @@ void Picture::RemoveObserver(PictureObserver* observer)
  */
 void Picture::UpdateObservers()
 {
+    UpdateObservers(AllChanged);
+}
+
+/**
+ * Update all observers now with the reasons for the update.
+ *
+ * Anything posted with PostUpdate and not yet delivered is
+ * delivered with it.
+ * @param reasons Update reasons, the Picture::...Changed flags
+ */
+void Picture::UpdateObservers(int reasons)
+{
+    reasons |= mPendingReasons;
+    mPendingReasons = 0;
+    mLastDelivery = wxGetLocalTimeMillis();
+
     for (auto observer : mObservers)
     {
-        observer->UpdateObserver();
+        observer->UpdateObserverReasons(reasons);
+    }
+}
+
+/**
+ * Post an update to the observers.
+ *
+ * Updates posted within one display frame are combined and
+ * delivered once with all of their reasons, so a burst of
+ * changes such as a mouse drag does not redraw the views
+ * for every change. Without a running application there is
+ * no event loop to deliver on later, so the update is
+ * delivered immediately.
+ * @param reasons Update reasons, the Picture::...Changed flags
+ */
+void Picture::PostUpdate(int reasons)
+{
+    mPendingReasons |= reasons;
+
+    if (wxTheApp == nullptr)
+    {
+        DeliverUpdates();
+        return;
+    }
+
+    if (mUpdateTimer == nullptr)
+    {
+        mUpdateTimer = std::make_unique<UpdateTimer>(this);
+    }
+
+    if (!mUpdateTimer->IsRunning())
+    {
+        long sinceLast = (wxGetLocalTimeMillis() - mLastDelivery).ToLong();
+        mUpdateTimer->StartOnce((int)std::max(1L, UpdateInterval - sinceLast));
     }
 }
 
+/**
+ * Deliver any posted updates to the observers
+ */
+void Picture::DeliverUpdates()
+{
+    if (mPendingReasons != 0)
+    {
+        UpdateObservers(0);
+    }
+}
+
+/**
+ * Timer notification, delivers the posted updates
+ */
+void Picture::UpdateTimer::Notify()
+{
+    mPicture->DeliverUpdates();
+}
+
 /**
  * Draw this picture on a device context
  * @param graphics The device context to draw on
  */
-void Picture::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Picture::Draw(RenderContext &graphics)
 {
+    TRACE_ZONE("Picture::Draw");
+
     for (auto actor : mActors)
     {
         actor->Draw(graphics);
@@ -103,6 +184,76 @@ void Picture::AddActor(std::shared_ptr<Actor> actor)
 {
     mActors.push_back(actor);
     actor->SetPicture(this);
+    mHitGridDirty = true;
+}
+
+
+/**
+ * Find the topmost drawable at a position in the picture.
+ *
+ * Only drawables whose placed bounds are in the grid cell
+ * containing the position are tested.
+ * @param pos Position in the picture
+ * @param hitActor Set to the actor that was hit or nullptr
+ * @return The drawable that was hit or nullptr if we missed
+ */
+std::shared_ptr<Drawable> Picture::HitTest(wxPoint pos, std::shared_ptr<Actor> &hitActor)
+{
+    UpdateHitGrid();
+
+    // Candidates are in reverse drawing order, so the
+    // first hit is the one on top.
+    mHitGrid.Query(wxPoint2DDouble(pos.x, pos.y), mHitCandidates);
+    for (auto id : mHitCandidates)
+    {
+        auto &entry = mHitEntries[id];
+        auto &actor = mActors[entry.mActor];
+        if (!actor->IsClickable() || !actor->IsEnabled())
+            continue;
+
+        if (entry.mDrawable->HitTest(pos))
+        {
+            hitActor = actor;
+            return entry.mDrawable;
+        }
+    }
+
+    hitActor = nullptr;
+    return nullptr;
+}
+
+
+/**
+ * Rebuild the hit test grid if anything has been placed
+ * somewhere new since it was built.
+ */
+void Picture::UpdateHitGrid()
+{
+    // The actor placement versions only increase, so the
+    // sum changes if any actor has been placed again.
+    long version = 0;
+    for (auto &actor : mActors)
+    {
+        actor->UpdatePlacement();
+        version += actor->GetPlacementVersion();
+    }
+
+    if (!mHitGridDirty && version == mHitGridVersion)
+        return;
+
+    mHitGridDirty = false;
+    mHitGridVersion = version;
+    mHitEntries.clear();
+    mHitGrid.Reset(mSize);
+
+    for (int a = 0; a < (int)mActors.size(); a++)
+    {
+        for (auto &drawable : mActors[a]->GetDrawables())
+        {
+            mHitGrid.Insert((int)mHitEntries.size(), drawable->GetPlacedBounds());
+            mHitEntries.push_back(HitEntry{a, drawable});
+        }
+    }
 }
 
 
@@ -112,6 +263,8 @@ void Picture::AddActor(std::shared_ptr<Actor> actor)
 */
 void Picture::Save(const wxString& filename)
 {
+    TRACE_ZONE("Picture::Save");
+
     wxXmlDocument xmlDoc;
 
     auto root = new wxXmlNode(wxXML_ELEMENT_NODE, L"anim");
@@ -143,6 +296,8 @@ void Picture::Save(const wxString& filename)
 */
 void Picture::Load(const wxString& filename)
 {
+    TRACE_ZONE("Picture::Load");
+
     wxXmlDocument xmlDoc;
     if(!xmlDoc.Load(filename))
     {
@@ -9,15 +9,32 @@
 #pragma once
 
 #include "Timeline.h"
+#include "SpatialGrid.h"
+
+#include <render-api.h>
 
 class PictureObserver;
 class Actor;
+class Drawable;
 
 /**
  *  Class that represents our animation picture
  */
 class Picture
 {
+public:
+    /// Update reason: the current animation time changed
+    static const int TimeChanged = 1;
+
+    /// Update reason: drawables moved or changed
+    static const int DrawablesChanged = 2;
+
+    /// Update reason: the timeline settings changed
+    static const int TimelineChanged = 4;
+
+    /// Update reason: anything may have changed
+    static const int AllChanged = TimeChanged | DrawablesChanged | TimelineChanged;
+
 private:
     /// The picture size
     wxSize mSize = wxSize(1500, 800);
@@ -34,6 +51,65 @@ private:
     /// The parent frame of this picture
     wxFrame* mParent = nullptr;
 
+    /// An actor drawable pair in the hit test grid
+    struct HitEntry
+    {
+        /// Index of the actor in mActors
+        int mActor;
+
+        /// The drawable to test
+        std::shared_ptr<Drawable> mDrawable;
+    };
+
+    /// Drawables in the hit test grid in drawing order.
+    /// The grid ids are indices into this vector.
+    std::vector<HitEntry> mHitEntries;
+
+    /// Grid over the placed drawable bounds
+    SpatialGrid mHitGrid;
+
+    /// Does the hit test grid need to be rebuilt even
+    /// if no drawable has moved?
+    bool mHitGridDirty = true;
+
+    /// Sum of the actor placement versions when the
+    /// hit test grid was built
+    long mHitGridVersion = 0;
+
+    /// Reused for the candidates of a hit test
+    std::vector<int> mHitCandidates;
+
+    void UpdateHitGrid();
+
+    /// Timer that delivers posted updates at most once per display frame
+    class UpdateTimer : public wxTimer
+    {
+    private:
+        /// The picture to deliver updates for
+        Picture *mPicture;
+
+    public:
+        /**
+         * Constructor
+         * @param picture The picture to deliver updates for
+         */
+        UpdateTimer(Picture *picture) : mPicture(picture) {}
+
+        void Notify() override;
+    };
+
+    /// Delivers posted updates. Created when first needed,
+    /// since a timer needs a running application.
+    std::unique_ptr<UpdateTimer> mUpdateTimer;
+
+    /// Reasons posted since the last delivery
+    int mPendingReasons = 0;
+
+    /// When updates were last delivered in milliseconds
+    wxLongLong mLastDelivery = 0;
+
+    void DeliverUpdates();
+
 public:
     Picture();
 
@@ -57,7 +133,7 @@ public:
      * Set the picture size
      * @param size Picture size in pixels
      */
-    void SetSize(wxSize size) {mSize = size;}
+    void SetSize(wxSize size) {mSize = size; mHitGridDirty = true;}
 
     /**
      * Get a pointer to the Timeline object
@@ -76,10 +152,14 @@ public:
     void AddObserver(PictureObserver *observer);
     void RemoveObserver(PictureObserver *observer);
     void UpdateObservers();
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics);
+    void UpdateObservers(int reasons);
+    void PostUpdate(int reasons);
+    void Draw(RenderContext &graphics);
 
     void AddActor(std::shared_ptr<Actor> actor);
 
+    std::shared_ptr<Drawable> HitTest(wxPoint pos, std::shared_ptr<Actor> &hitActor);
+
     /** Iterator that iterates over the actors in a picture */
     class ActorIter
     {
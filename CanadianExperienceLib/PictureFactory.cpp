@@ -5,6 +5,8 @@
  */
 
 #include "pch.h"
+#include <image-cache-api.h>
+#include <machine-images-api.h>
 #include "PictureFactory.h"
 #include "Picture.h"
 #include "HaroldFactory.h"
@@ -17,6 +19,9 @@
 /// Directory within resources that contains the images.
 const std::wstring ImagesDirectory = L"/images";
 
+/// Image file for the background
+const std::wstring BackgroundImage = L"/Background.jpg";
+
 /// The start time for the machine on the left of the screen
 const double LeftMachineStartTime = 0;
 
@@ -33,6 +38,12 @@ std::shared_ptr<Picture> PictureFactory::Create(std::wstring resourcesDir)
 {
     auto imagesDir = resourcesDir + ImagesDirectory;
 
+    //
+    // Decode the images the picture's actors and machines use before
+    // building anything, so the decoding can happen in parallel.
+    //
+    ImageCache::Preload(GetImages(resourcesDir));
+
     auto picture = std::make_shared<Picture>();
 
     //
@@ -42,7 +53,7 @@ std::shared_ptr<Picture> PictureFactory::Create(std::wstring resourcesDir)
     background->SetClickable(false);
     background->SetPosition(wxPoint(0, 0));
     auto backgroundI =
-            std::make_shared<ImageDrawable>(L"Background", imagesDir + L"/Background.jpg");
+            std::make_shared<ImageDrawable>(L"Background", imagesDir + BackgroundImage);
     background->AddDrawable(backgroundI);
     background->SetRoot(backgroundI);
     picture->AddActor(background);
@@ -95,3 +106,31 @@ std::shared_ptr<Picture> PictureFactory::Create(std::wstring resourcesDir)
     return picture;
 }
 
+
+/**
+ * Get the image files the actors and machines in the picture use
+ * @param resourcesDir Directory that contains the resources for this application
+ * @return Image filenames, named the same way the factories load them
+ */
+std::vector<std::wstring> PictureFactory::GetImages(const std::wstring &resourcesDir)
+{
+    auto imagesDir = resourcesDir + ImagesDirectory;
+    std::vector<std::wstring> filenames = {imagesDir + BackgroundImage};
+
+    for (auto &filename : HaroldFactory().GetImages(imagesDir))
+    {
+        filenames.push_back(filename);
+    }
+
+    for (auto &filename : SpartyFactory().GetImages(imagesDir))
+    {
+        filenames.push_back(filename);
+    }
+
+    for (auto &filename : MachineImages::Get(resourcesDir))
+    {
+        filenames.push_back(filename);
+    }
+
+    return filenames;
+}
@@ -14,6 +14,9 @@ class Picture;
  * A factory class that builds our picture.
  */
 class PictureFactory {
+private:
+    std::vector<std::wstring> GetImages(const std::wstring &resourcesDir);
+
 public:
     std::shared_ptr<Picture> Create(std::wstring resourcesDir);
 };
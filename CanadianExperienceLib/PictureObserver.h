@@ -36,6 +36,14 @@ public:
     /// This function is called to update any observers
     virtual void UpdateObserver() = 0;
 
+    /**
+     * This function is called to update any observers with the
+     * reasons for the update. Observers that can redraw less for
+     * some reasons override it. By default it calls UpdateObserver().
+     * @param reasons Update reasons, the Picture::...Changed flags
+     */
+    virtual void UpdateObserverReasons(int reasons) { UpdateObserver(); }
+
     virtual void SetPicture(std::shared_ptr<Picture> picture);
 
     /**
@@ -0,0 +1,81 @@
+/**
+ * @file PlaybackScheduler.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "PlaybackScheduler.h"
+
+/// A frame shown more than this fraction of a frame
+/// after it was due is counted as late
+const double LateTolerance = 0.5;
+
+/// Slack for clock values that land exactly on a frame
+const double FrameEpsilon = 1e-6;
+
+/**
+ * Start playback
+ * @param frame The frame already showing
+ * @param clock The current clock time in seconds
+ * @param frameRate Animation frame rate in frames per second
+ * @param numFrames Number of frames in the animation
+ */
+void PlaybackScheduler::Start(int frame, double clock, int frameRate, int numFrames)
+{
+    mFrameRate = std::max(frameRate, 1);
+    mNumFrames = numFrames;
+    mFrame = std::min(frame, numFrames);
+    mClockStart = clock - (double)mFrame / mFrameRate;
+
+    mShownFrames = 0;
+    mDroppedFrames = 0;
+    mLateFrames = 0;
+}
+
+/**
+ * Decide what to show at a clock time
+ * @param clock The current clock time in seconds
+ * @return The frame to show or NoFrame if the next frame is not due yet
+ */
+int PlaybackScheduler::Tick(double clock)
+{
+    double time = clock - mClockStart;
+    int due = std::min((int)floor(time * mFrameRate + FrameEpsilon), mNumFrames);
+    if (due <= mFrame)
+    {
+        return NoFrame;
+    }
+
+    int frame = mNeverDrop ? mFrame + 1 : due;
+
+    // How far past its due time this frame is, in frames
+    double lateness = time * mFrameRate - frame;
+    if (lateness > LateTolerance)
+    {
+        mLateFrames++;
+    }
+
+    if (mNeverDrop)
+    {
+        // Move the clock so this frame is on time and
+        // the frames after it are due a frame apart
+        mClockStart = clock - (double)frame / mFrameRate;
+    }
+    else
+    {
+        mDroppedFrames += frame - mFrame - 1;
+    }
+
+    mFrame = frame;
+    mShownFrames++;
+    return frame;
+}
+
+/**
+ * Get when the next frame is due
+ * @return Clock time in seconds
+ */
+double PlaybackScheduler::NextDeadline() const
+{
+    return mClockStart + (double)(mFrame + 1) / mFrameRate;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file PlaybackScheduler.h
+ * @author Mate Narh
+ *
+ * Decides which animation frame to show during playback.
+ */
+
+#ifndef CANADIANEXPERIENCE_PLAYBACKSCHEDULER_H
+#define CANADIANEXPERIENCE_PLAYBACKSCHEDULER_H
+
+/**
+ * Decides which animation frame to show during playback.
+ *
+ * Playback is driven by a clock in seconds rather than by counting
+ * timer ticks, so slow ticks do not slow the animation down. When
+ * a tick arrives after more than one frame has come due, the frames
+ * in between are dropped: the animation jumps to the newest due
+ * frame, which still advances any simulation through them, but they
+ * are never drawn. In never drop mode every frame is shown and
+ * playback falls behind the clock instead.
+ */
+class PlaybackScheduler {
+private:
+    /// Animation frame rate in frames per second
+    int mFrameRate = 30;
+
+    /// Number of frames in the animation
+    int mNumFrames = 0;
+
+    /// Show every frame, even when that falls behind the clock
+    bool mNeverDrop = false;
+
+    /// The last frame shown
+    int mFrame = 0;
+
+    /// Clock time in seconds at which frame zero was due
+    double mClockStart = 0;
+
+    /// Number of frames shown
+    int mShownFrames = 0;
+
+    /// Number of frames skipped without being shown
+    int mDroppedFrames = 0;
+
+    /// Number of frames shown late
+    int mLateFrames = 0;
+
+public:
+    /// Value returned by Tick when there is no new frame to show
+    static const int NoFrame = -1;
+
+    PlaybackScheduler() {}
+
+    /// Copy constructor (disabled)
+    PlaybackScheduler(const PlaybackScheduler &) = delete;
+
+    /// Assignment operator
+    void operator=(const PlaybackScheduler &) = delete;
+
+    void Start(int frame, double clock, int frameRate, int numFrames);
+    int Tick(double clock);
+    double NextDeadline() const;
+
+    /**
+     * Set never drop mode
+     * @param neverDrop If true, every frame is shown
+     */
+    void SetNeverDrop(bool neverDrop) { mNeverDrop = neverDrop; }
+
+    /**
+     * Get never drop mode
+     * @return true if every frame is shown
+     */
+    bool IsNeverDrop() const { return mNeverDrop; }
+
+    /**
+     * Has the last frame been shown?
+     * @return true if playback is finished
+     */
+    bool IsFinished() const { return mFrame >= mNumFrames; }
+
+    /**
+     * Get the last frame shown
+     * @return Frame number
+     */
+    int GetFrame() const { return mFrame; }
+
+    /**
+     * Get the number of frames shown since Start
+     * @return Number of frames
+     */
+    int GetShownFrames() const { return mShownFrames; }
+
+    /**
+     * Get the number of frames dropped since Start
+     * @return Number of frames
+     */
+    int GetDroppedFrames() const { return mDroppedFrames; }
+
+    /**
+     * Get the number of frames shown late since Start
+     * @return Number of frames
+     */
+    int GetLateFrames() const { return mLateFrames; }
+};
+
+#endif //CANADIANEXPERIENCE_PLAYBACKSCHEDULER_H
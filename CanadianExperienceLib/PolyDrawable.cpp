@@ -16,48 +16,83 @@ PolyDrawable::PolyDrawable(const std::wstring &name) : Drawable(name)
 
 /**
  * Draw our polygon.
+ *
+ * The path is kept in local coordinates, so drawing only
+ * needs the placed position and rotation applied as a transform.
  * @param  graphics The graphics context to draw on
  */
-void PolyDrawable::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void PolyDrawable::Draw(RenderContext &graphics)
 {
-    if(!mPoints.empty()) {
-
-        mPath = graphics->CreatePath();
-        mPath.MoveToPoint(RotatePoint(mPoints[0], mPlacedR) + mPlacedPosition);
-        for (auto i = 1; i<mPoints.size(); i++)
-        {
-            mPath.AddLineToPoint(RotatePoint(mPoints[i], mPlacedR) + mPlacedPosition);
-        }
-        mPath.CloseSubpath();
-
-        wxBrush brush(mColor);
-        graphics->SetBrush(brush);
-        graphics->FillPath(mPath);
+    if(mPoints.empty())
+    {
+        return;
     }
 
+    graphics.SetBrush(mColor);
 
-
-
-//    SolidBrush brush(mColor);
-//
-//    // Transform the points
-//    vector<Point> points;
-//    for (auto point : mPoints)
-//    {
-//        points.push_back(RotatePoint(point, mPlacedR) + mPlacedPosition);
-//    }
-//
-//    graphics->FillPolygon(&brush, &points[0], (int)points.size());
+    graphics->PushState();
+    graphics->Translate(mPlacedPosition.m_x, mPlacedPosition.m_y);
+    graphics->Rotate(-mPlacedR);
+    graphics->FillPath(GetPath(graphics));
+    graphics->PopState();
 }
 
 
 /** Test to see if we hit this object with a mouse click
+ *
+ * The click is transformed back into the local coordinates
+ * of the polygon and tested against the points directly,
+ * so this does not depend on the polygon having been drawn.
  * @param pos Click position
  * @return true it hit
  */
 bool PolyDrawable::HitTest(wxPoint pos)
 {
-    return mPath.Contains(pos.x, pos.y);
+    if(mPoints.empty())
+    {
+        return false;
+    }
+
+    auto local = mPlacedTransform.InverseTransformPoint(wxPoint2DDouble(pos.x, pos.y));
+    double x = local.m_x;
+    double y = local.m_y;
+
+    // Count edge crossings to the right of the point. This is
+    // the same odd/even rule used when filling the path.
+    bool inside = false;
+    for (size_t i = 0, j = mPoints.size() - 1; i < mPoints.size(); j = i++)
+    {
+        const auto &a = mPoints[i];
+        const auto &b = mPoints[j];
+        if ((a.y > y) != (b.y > y) &&
+                x < a.x + (b.x - a.x) * (y - a.y) / double(b.y - a.y))
+        {
+            inside = !inside;
+        }
+    }
+
+    return inside;
+}
+
+
+/**
+ * Get the bounding box of the polygon in local coordinates
+ * @return Local bounding box
+ */
+wxRect2DDouble PolyDrawable::GetLocalBounds()
+{
+    if(mPoints.empty())
+    {
+        return wxRect2DDouble();
+    }
+
+    wxRect2DDouble bounds(mPoints[0].x, mPoints[0].y, 0, 0);
+    for (auto &point : mPoints)
+    {
+        bounds.Union(wxPoint2DDouble(point.x, point.y));
+    }
+
+    return bounds;
 }
 
 
@@ -68,4 +103,31 @@ bool PolyDrawable::HitTest(wxPoint pos)
 void PolyDrawable::AddPoint(wxPoint point)
 {
     mPoints.push_back(point);
+
+    // The path and the placed bounds no longer match the points
+    mPath = wxGraphicsPath();
+    MarkPlacementDirty();
+}
+
+
+/**
+ * Get the local coordinate path for this polygon,
+ * building it if the points have changed.
+ * @param graphics Graphics context used to create the path
+ * @return Graphics path in local coordinates
+ */
+const wxGraphicsPath& PolyDrawable::GetPath(RenderContext &graphics)
+{
+    if(mPath.IsNull())
+    {
+        mPath = graphics->CreatePath();
+        mPath.MoveToPoint(mPoints[0]);
+        for (auto i = 1; i<mPoints.size(); i++)
+        {
+            mPath.AddLineToPoint(mPoints[i]);
+        }
+        mPath.CloseSubpath();
+    }
+
+    return mPath;
 }
@@ -25,10 +25,13 @@ private:
     /// The array of point objects
     std::vector<wxPoint> mPoints;
 
-    /// The transformed graphics path used
-    /// to draw this polygon
+    /// The graphics path for this polygon in local
+    /// (untransformed) coordinates. Built when first
+    /// needed after the points change.
     wxGraphicsPath mPath;
 
+    const wxGraphicsPath& GetPath(RenderContext &graphics);
+
 public:
     PolyDrawable(const std::wstring& name);
 
@@ -41,8 +44,9 @@ public:
     /// Assignment operator
     void operator=(const PolyDrawable &) = delete;
 
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
     bool HitTest(wxPoint pos) override;
+    wxRect2DDouble GetLocalBounds() override;
 
     void AddPoint(wxPoint point);
 
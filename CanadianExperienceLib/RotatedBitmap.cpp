@@ -4,6 +4,7 @@
  */
 
 #include "pch.h"
+#include <image-cache-api.h>
 #include "RotatedBitmap.h"
 
 
@@ -14,7 +15,8 @@
  */
 void RotatedBitmap::LoadImage(const std::wstring &filename)
 {
-    mImage = std::make_unique<wxImage>(filename, wxBITMAP_TYPE_ANY);
+    auto image = ImageCache::Get(filename);
+    mImage = image != nullptr ? std::make_unique<wxImage>(*image) : std::make_unique<wxImage>();
     mLoaded = true;
 }
 
@@ -25,7 +27,7 @@ void RotatedBitmap::LoadImage(const std::wstring &filename)
  * @param position The position to draw at
  * @param angle The rotation angle
  */
-void RotatedBitmap::DrawImage(std::shared_ptr<wxGraphicsContext> graphics, wxPoint position, double angle)
+void RotatedBitmap::DrawImage(const std::shared_ptr<wxGraphicsContext> &graphics, wxPoint2DDouble position, double angle)
 {
     if(!mBitmapCreated)
     {
@@ -33,7 +35,7 @@ void RotatedBitmap::DrawImage(std::shared_ptr<wxGraphicsContext> graphics, wxPoi
     }
 
     graphics->PushState();
-    graphics->Translate(position.x, position.y);
+    graphics->Translate(position.m_x, position.m_y);
     graphics->Rotate(-angle);
     graphics->DrawBitmap(mBitmap, -mCenter.x, -mCenter.y,
             mImage->GetWidth(), mImage->GetHeight());
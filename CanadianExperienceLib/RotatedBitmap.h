@@ -40,7 +40,7 @@ public:
 
     void LoadImage(const std::wstring& filename);
 
-    void DrawImage(std::shared_ptr<wxGraphicsContext> graphics, wxPoint position, double angle);
+    void DrawImage(const std::shared_ptr<wxGraphicsContext> &graphics, wxPoint2DDouble position, double angle);
 
     /**
      * Set the center to rotate around
@@ -10,6 +10,36 @@
 #include "ImageDrawable.h"
 #include "HeadTop.h"
 
+/// Image file for Sparty's torso
+const std::wstring TorsoImage = L"/sparty_torso.png";
+
+/// Image file for Sparty's left leg
+const std::wstring LeftLegImage = L"/sparty_lleg.png";
+
+/// Image file for Sparty's right leg
+const std::wstring RightLegImage = L"/sparty_rleg.png";
+
+/// Image file for Sparty's left arm
+const std::wstring LeftArmImage = L"/sparty_larm.png";
+
+/// Image file for Sparty's right arm
+const std::wstring RightArmImage = L"/sparty_rarm.png";
+
+/// Image file for Sparty's flag
+const std::wstring FlagImage = L"/msu_flag.png";
+
+/// Image file for Sparty's head bottom
+const std::wstring HeadBottomImage = L"/sparty_lhead.png";
+
+/// Image file for Sparty's head top
+const std::wstring HeadTopImage = L"/sparty_head.png";
+
+/// Image file for Sparty's left eye
+const std::wstring LeftEyeImage = L"/sparty_leye.png";
+
+/// Image file for Sparty's right eye
+const std::wstring RightEyeImage = L"/sparty_reye.png";
+
 
 /**
  * This is a factory method that creates our Harold actor.
@@ -20,50 +50,50 @@ std::shared_ptr<Actor> SpartyFactory::Create(std::wstring imagesDir)
 {
     std::shared_ptr<Actor> actor = std::make_shared<Actor>(L"Sparty");
 
-    auto torso = std::make_shared<ImageDrawable>(L"Torso", imagesDir +L"/sparty_torso.png");
+    auto torso = std::make_shared<ImageDrawable>(L"Torso", imagesDir + TorsoImage);
     torso->SetCenter(wxPoint(69, 144));
     torso->SetPosition(wxPoint(0, -200));
     actor->SetRoot(torso);
 
-    auto lleg = std::make_shared<ImageDrawable>(L"Left Leg", imagesDir +L"/sparty_lleg.png");
+    auto lleg = std::make_shared<ImageDrawable>(L"Left Leg", imagesDir + LeftLegImage);
     lleg->SetCenter(wxPoint(40, 27));
     lleg->SetPosition(wxPoint(102 - 69, 180 - 144));
     torso->AddChild(lleg);
 
-    auto rleg = std::make_shared<ImageDrawable>(L"Right Leg", imagesDir +L"/sparty_rleg.png");
+    auto rleg = std::make_shared<ImageDrawable>(L"Right Leg", imagesDir + RightLegImage);
     rleg->SetCenter(wxPoint(34, 27));
     rleg->SetPosition(wxPoint(36 - 69, 180 - 144));
     torso->AddChild(rleg);
 
-    auto larm = std::make_shared<ImageDrawable>(L"Left Arm", imagesDir +L"/sparty_larm.png");
+    auto larm = std::make_shared<ImageDrawable>(L"Left Arm", imagesDir + LeftArmImage);
     larm->SetCenter(wxPoint(25, 26));
     larm->SetPosition(wxPoint(120 - 69, 22 - 144));
     torso->AddChild(larm);
 
-    auto rarm = std::make_shared<ImageDrawable>(L"Right Arm", imagesDir +L"/sparty_rarm.png");
+    auto rarm = std::make_shared<ImageDrawable>(L"Right Arm", imagesDir + RightArmImage);
     rarm->SetCenter(wxPoint(89, 26));
     rarm->SetPosition(wxPoint(20 - 69, 22 - 144));
 
-    auto flag = std::make_shared<ImageDrawable>(L"Flag", imagesDir +L"/msu_flag.png");
+    auto flag = std::make_shared<ImageDrawable>(L"Flag", imagesDir + FlagImage);
     flag->SetCenter(wxPoint(25, 250));
     flag->SetPosition(wxPoint(90, 100));
     larm->AddChild(flag);
 
     torso->AddChild(rarm);
 
-    auto headb = std::make_shared<ImageDrawable>(L"Head Bottom", imagesDir +L"/sparty_lhead.png");
+    auto headb = std::make_shared<ImageDrawable>(L"Head Bottom", imagesDir + HeadBottomImage);
     headb->SetCenter(wxPoint(53, 30));
     headb->SetPosition(wxPoint(0, 37 - 144));
     torso->AddChild(headb);
 
-    auto headt = std::make_shared<HeadTop>(L"Head Top", imagesDir +L"/sparty_head.png");
+    auto headt = std::make_shared<HeadTop>(L"Head Top", imagesDir + HeadTopImage);
     headt->SetCenter(wxPoint(59, 143));
     headt->SetPosition(wxPoint(0, -28));
     headb->AddChild(headt);
     headt->SetEyesCenter(wxPoint(54, 110));
-    headt->GetLeftEye()->LoadImage(imagesDir +L"/sparty_leye.png");
+    headt->GetLeftEye()->LoadImage(imagesDir + LeftEyeImage);
     headt->GetLeftEye()->SetCenter(wxPoint(14, 14));
-    headt->GetRightEye()->LoadImage(imagesDir +L"/sparty_reye.png");
+    headt->GetRightEye()->LoadImage(imagesDir + RightEyeImage);
     headt->GetRightEye()->SetCenter(wxPoint(17, 16));
     headt->SetInterocularDistance(30);
 
@@ -77,4 +107,23 @@ std::shared_ptr<Actor> SpartyFactory::Create(std::wstring imagesDir)
     actor->AddDrawable(headt);
 
     return actor;
-}
\ No newline at end of file
+}
+
+/**
+ * Get the image files the actor this factory creates uses
+ * @param imagesDir Directory that contains the images for this application
+ * @return Image filenames, named the same way Create loads them
+ */
+std::vector<std::wstring> SpartyFactory::GetImages(std::wstring imagesDir)
+{
+    return {imagesDir + TorsoImage,
+            imagesDir + LeftLegImage,
+            imagesDir + RightLegImage,
+            imagesDir + LeftArmImage,
+            imagesDir + RightArmImage,
+            imagesDir + FlagImage,
+            imagesDir + HeadBottomImage,
+            imagesDir + HeadTopImage,
+            imagesDir + LeftEyeImage,
+            imagesDir + RightEyeImage};
+}
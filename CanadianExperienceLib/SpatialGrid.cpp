@@ -0,0 +1,111 @@
+/**
+ * @file SpatialGrid.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "SpatialGrid.h"
+
+/**
+ * Constructor
+ * @param cellSize Width and height of a grid cell in pixels
+ */
+SpatialGrid::SpatialGrid(double cellSize) : mCellSize(cellSize)
+{
+    mCells.resize(1);
+}
+
+/**
+ * Remove all items and size the grid to cover an area
+ * starting at (0, 0). Items outside the area are kept in
+ * the cells along the edge.
+ * @param size Size of the area to cover
+ */
+void SpatialGrid::Reset(wxSize size)
+{
+    mColumns = std::max(1, int(ceil(size.GetWidth() / mCellSize)));
+    mRows = std::max(1, int(ceil(size.GetHeight() / mCellSize)));
+
+    // Clearing keeps the capacity of the cells we already had
+    mCells.resize(mColumns * mRows);
+    for (auto &cell : mCells)
+    {
+        cell.clear();
+    }
+
+    mEverywhere.clear();
+}
+
+/**
+ * Add an item to the grid
+ * @param id Item id, must be larger than any id already added
+ * @param bounds Bounding box of the item
+ */
+void SpatialGrid::Insert(int id, const wxRect2DDouble &bounds)
+{
+    if (bounds.IsEmpty())
+    {
+        mEverywhere.push_back(id);
+        return;
+    }
+
+    int c1 = Column(bounds.GetLeft());
+    int c2 = Column(bounds.GetRight());
+    int r1 = Row(bounds.GetTop());
+    int r2 = Row(bounds.GetBottom());
+
+    for (int r = r1; r <= r2; r++)
+    {
+        for (int c = c1; c <= c2; c++)
+        {
+            mCells[r * mColumns + c].push_back(id);
+        }
+    }
+}
+
+/**
+ * Find the items that may be under a point
+ * @param point Point to test
+ * @param candidates Filled with candidate ids, largest id first
+ */
+void SpatialGrid::Query(const wxPoint2DDouble &point, std::vector<int> &candidates) const
+{
+    candidates.clear();
+
+    const auto &cell = mCells[Row(point.m_y) * mColumns + Column(point.m_x)];
+
+    // Merge the two lists, both of which are in increasing order
+    auto c = cell.rbegin();
+    auto e = mEverywhere.rbegin();
+    while (c != cell.rend() || e != mEverywhere.rend())
+    {
+        if (e == mEverywhere.rend() || (c != cell.rend() && *c > *e))
+        {
+            candidates.push_back(*c++);
+        }
+        else
+        {
+            candidates.push_back(*e++);
+        }
+    }
+}
+
+/**
+ * Get the grid column for an X coordinate
+ * @param x X coordinate in pixels
+ * @return Column, clamped to the grid
+ */
+int SpatialGrid::Column(double x) const
+{
+    return std::clamp(int(floor(x / mCellSize)), 0, mColumns - 1);
+}
+
+/**
+ * Get the grid row for a Y coordinate
+ * @param y Y coordinate in pixels
+ * @return Row, clamped to the grid
+ */
+int SpatialGrid::Row(double y) const
+{
+    return std::clamp(int(floor(y / mCellSize)), 0, mRows - 1);
+}
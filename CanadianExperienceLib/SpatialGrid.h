@@ -0,0 +1,55 @@
+/**
+ * @file SpatialGrid.h
+ * @author Mate Narh
+ *
+ * A uniform grid used to find the items that may be under a point.
+ */
+
+#ifndef CANADIANEXPERIENCE_SPATIALGRID_H
+#define CANADIANEXPERIENCE_SPATIALGRID_H
+
+/**
+ * A uniform grid used to find the items that may be under a point.
+ *
+ * Items are identified by integer ids that must be inserted in
+ * increasing order. Each item is added to every cell its bounding
+ * box overlaps. Items with empty bounds are candidates everywhere.
+ */
+class SpatialGrid {
+private:
+    /// Width and height of a grid cell in pixels
+    double mCellSize;
+
+    /// Number of grid columns
+    int mColumns = 1;
+
+    /// Number of grid rows
+    int mRows = 1;
+
+    /// The ids in each cell in increasing order, row major
+    std::vector<std::vector<int>> mCells;
+
+    /// Ids of items with no bounds, these are candidates everywhere
+    std::vector<int> mEverywhere;
+
+    int Column(double x) const;
+    int Row(double y) const;
+
+public:
+    SpatialGrid(double cellSize);
+
+    /// Default constructor (disabled)
+    SpatialGrid() = delete;
+
+    /// Copy constructor (disabled)
+    SpatialGrid(const SpatialGrid &) = delete;
+
+    /// Assignment operator
+    void operator=(const SpatialGrid &) = delete;
+
+    void Reset(wxSize size);
+    void Insert(int id, const wxRect2DDouble &bounds);
+    void Query(const wxPoint2DDouble &point, std::vector<int> &candidates) const;
+};
+
+#endif //CANADIANEXPERIENCE_SPATIALGRID_H
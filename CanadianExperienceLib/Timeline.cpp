@@ -6,6 +6,7 @@
 #include "pch.h"
 #include "Timeline.h"
 #include "AnimChannel.h"
+#include <trace-api.h>
 
 /**
  * Constructor
@@ -34,6 +35,8 @@ void Timeline::AddChannel(AnimChannel *channel)
 */
 void Timeline::SetCurrentTime(double t)
 {
+    TRACE_ZONE("Timeline::SetCurrentTime");
+
     // Set the time
     mCurrentTime = t;
 
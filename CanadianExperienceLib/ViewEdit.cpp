@@ -37,6 +37,8 @@ ViewEdit::ViewEdit(wxFrame* parent) :wxScrolledCanvas(parent, wxID_ANY)
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewEdit::OnEditRotate, this, XRCID("EditRotate"));
     parent->Bind(wxEVT_UPDATE_UI, &ViewEdit::OnUpdateEditMove, this, XRCID("EditMove"));
     parent->Bind(wxEVT_UPDATE_UI, &ViewEdit::OnUpdateEditRotate, this, XRCID("EditRotate"));
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewEdit::OnViewPerformance, this, XRCID("ViewPerformance"));
+    parent->Bind(wxEVT_UPDATE_UI, &ViewEdit::OnUpdateViewPerformance, this, XRCID("ViewPerformance"));
 
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewEdit::OnEditLeftMachineNumber, this, XRCID("EditLeftMachineNumber"));
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewEdit::OnEditRightMachineNumber, this, XRCID("EditRightMachineNumber"));
@@ -59,6 +61,19 @@ void ViewEdit::UpdateObserver()
     Refresh();
 }
 
+/**
+ * Update this window for the reasons the picture changed.
+ * Timeline settings changes do not affect what is drawn here.
+ * @param reasons Update reasons, the Picture::...Changed flags
+ */
+void ViewEdit::UpdateObserverReasons(int reasons)
+{
+    if (reasons & (Picture::TimeChanged | Picture::DrawablesChanged))
+    {
+        Refresh();
+    }
+}
+
 
 
 /**
@@ -79,9 +94,14 @@ void ViewEdit::OnPaint(wxPaintEvent& event)
     dc.Clear();
 
     // Create a graphics context
-    auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create( dc ));
+    RenderContext graphics(std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create( dc )));
 
+    mHud.FrameBegin();
     GetPicture()->Draw(graphics);
+    mHud.FrameEnd();
+
+    // The overlay stays in the top left corner of the window
+    mHud.Draw(graphics, CalcUnscrolledPosition(wxPoint(0, 0)));
 }
 
 /**
@@ -98,19 +118,7 @@ void ViewEdit::OnLeftDown(wxMouseEvent &event)
     //
 
     std::shared_ptr<Actor> hitActor;
-    std::shared_ptr<Drawable> hitDrawable;
-    for (auto actor : *GetPicture())
-    {
-        // Note: We do not exit when we get the first hit, since
-        // we are looking at these in drawing order. Instead, we
-        // keep the last hit.
-        std::shared_ptr<Drawable> drawable = actor->HitTest(wxPoint(click.x, click.y));
-        if (drawable != nullptr)
-        {
-            hitActor = actor;
-            hitDrawable = drawable;
-        }
-    }
+    std::shared_ptr<Drawable> hitDrawable = GetPicture()->HitTest(wxPoint(click.x, click.y), hitActor);
 
     // If we hit something determine what we do with it based on the
     // current mode.
@@ -157,7 +165,7 @@ void ViewEdit::OnMouseMove(wxMouseEvent &event)
                 {
                     mSelectedActor->SetPosition(mSelectedActor->GetPosition() + delta);
                 }
-                GetPicture()->UpdateObservers();
+                GetPicture()->PostUpdate(Picture::DrawablesChanged);
             }
             break;
 
@@ -165,7 +173,7 @@ void ViewEdit::OnMouseMove(wxMouseEvent &event)
             if (mSelectedDrawable != nullptr)
             {
                 mSelectedDrawable->SetRotation(mSelectedDrawable->GetRotation() + delta.y * RotationScaling);
-                GetPicture()->UpdateObservers();
+                GetPicture()->PostUpdate(Picture::DrawablesChanged);
             }
             break;
 
@@ -209,6 +217,25 @@ void ViewEdit::OnEditRotate(wxCommandEvent& event)
     mMode = Mode::Rotate;
 }
 
+/**
+ * Handle the View>Performance Overlay menu option
+ * @param event The menu event
+ */
+void ViewEdit::OnViewPerformance(wxCommandEvent& event)
+{
+    mHud.SetVisible(!mHud.IsVisible());
+    Refresh();
+}
+
+/**
+ * Update the user interface for View>Performance Overlay
+ * @param event The event we update
+ */
+void ViewEdit::OnUpdateViewPerformance(wxUpdateUIEvent& event)
+{
+    event.Check(mHud.IsVisible());
+}
+
 /**
  * Update the user interface for Edit>Move
  * @param event The event we update
@@ -13,6 +13,7 @@
 #define CANADIANEXPERIENCE_VIEWEDIT_H
 
 #include "PictureObserver.h"
+#include "PerformanceHud.h"
 
 class Actor;
 class Drawable;
@@ -32,6 +33,8 @@ private:
     void OnEditRotate(wxCommandEvent& event);
     void OnUpdateEditMove(wxUpdateUIEvent& event);
     void OnUpdateEditRotate(wxUpdateUIEvent& event);
+    void OnViewPerformance(wxCommandEvent& event);
+    void OnUpdateViewPerformance(wxUpdateUIEvent& event);
 
     void OnEditLeftMachineNumber(wxCommandEvent& event);
     void OnEditRightMachineNumber(wxCommandEvent& event);
@@ -47,6 +50,9 @@ private:
     /// The currently selected drawable
     std::shared_ptr<Drawable> mSelectedDrawable;
 
+    /// Performance overlay
+    PerformanceHud mHud;
+
 public:
     /// The current mouse mode
     enum class Mode {Move, Rotate};
@@ -58,6 +64,7 @@ public:
     ViewEdit(wxFrame* parent);
 
     void UpdateObserver() override;
+    void UpdateObserverReasons(int reasons) override;
 
 };
 
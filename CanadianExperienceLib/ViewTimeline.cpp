@@ -7,7 +7,6 @@
 
 #include <wx/dcbuffer.h>
 #include <wx/xrc/xmlres.h>
-#include <sstream>
 
 #include "ViewTimeline.h"
 #include "TimelineDlg.h"
@@ -35,6 +34,10 @@ const int BorderLeft = 10;
 /// Space to the right of the scale
 const int BorderRight = 10;
 
+/// Distance in pixels outside the visible area to draw
+/// ticks for, so labels that hang into view are drawn
+const int LabelMargin = 20;
+
 /// Filename for the pointer image
 const std::wstring PointerImageFile = L"/pointer.png";
 
@@ -49,7 +52,8 @@ ViewTimeline::ViewTimeline(wxFrame* parent, std::wstring imagesDir) :
             wxID_ANY,
             wxDefaultPosition,
             wxSize(100, Height),
-            wxBORDER_SIMPLE)
+            wxBORDER_SIMPLE),
+    mTickLabels(TickFontSize, *wxBLACK)
 {
     SetBackgroundStyle(wxBG_STYLE_PAINT);
 
@@ -69,6 +73,8 @@ ViewTimeline::ViewTimeline(wxFrame* parent, std::wstring imagesDir) :
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewTimeline::OnPlayPlay, this, XRCID("PlayPlay"));
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewTimeline::OnPlayStop, this, XRCID("PlayStop"));
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewTimeline::OnPlayPlayFromBeginning, this, XRCID("PlayPlayFromBeginning"));
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &ViewTimeline::OnPlayNeverDrop, this, XRCID("PlayNeverDrop"));
+    parent->Bind(wxEVT_UPDATE_UI, &ViewTimeline::OnUpdatePlayNeverDrop, this, XRCID("PlayNeverDrop"));
 
     mTimer.SetOwner(this);
     mStopWatch.Start(0);
@@ -81,7 +87,47 @@ ViewTimeline::ViewTimeline(wxFrame* parent, std::wstring imagesDir) :
 void ViewTimeline::UpdateObserver()
 {
     Refresh();
-    Update();
+}
+
+/**
+ * Update this window for the reasons the picture changed.
+ *
+ * When only the animation time changed, just the old and
+ * new pointer locations are repainted.
+ * @param reasons Update reasons, the Picture::...Changed flags
+ */
+void ViewTimeline::UpdateObserverReasons(int reasons)
+{
+    if (reasons == Picture::TimeChanged && mPointerX >= 0)
+    {
+        RefreshPointer(mPointerX);
+        RefreshPointer(PointerX());
+    }
+    else
+    {
+        Refresh();
+    }
+}
+
+/**
+ * Get where the pointer goes for the current time
+ * @return Pointer x in unscrolled coordinates
+ */
+int ViewTimeline::PointerX()
+{
+    Timeline *timeline = GetPicture()->GetTimeline();
+    return BorderLeft + (int)(timeline->GetCurrentTime() * timeline->GetFrameRate() * TickSpacing);
+}
+
+/**
+ * Invalidate the area the pointer covers at some location
+ * @param x Pointer x in unscrolled coordinates
+ */
+void ViewTimeline::RefreshPointer(int x)
+{
+    int pw = mPointerImage->GetWidth();
+    int ph = mPointerImage->GetHeight();
+    RefreshRect(wxRect(CalcScrolledPosition(wxPoint(x - pw / 2, TickTop)), wxSize(pw, ph)), false);
 }
 
 /**
@@ -111,54 +157,94 @@ void ViewTimeline::OnPaint(wxPaintEvent& event)
         mPointerBitmap = graphics->CreateBitmapFromImage(*mPointerImage);
     }
 
-    auto rect = GetClientRect();
-    int hit = rect.GetHeight();
-    int wid = rect.GetWidth();
+    //
+    // Draw the tick marks and labels for the part
+    // of the timeline that is visible
+    //
+    auto size = GetClientSize();
+    wxRect visible(CalcUnscrolledPosition(wxPoint(0, 0)), size);
+    if(mStripBitmap.IsNull() || visible != mStripRect ||
+        timeline->GetFrameRate() != mStripFrameRate ||
+        timeline->GetNumFrames() != mStripNumFrames ||
+        graphics->GetContentScaleFactor() != mStripScale)
+    {
+        DrawStrip(graphics, timeline, visible);
+    }
 
-    wxFont font(wxSize(0, TickFontSize),
-            wxFONTFAMILY_SWISS,
-            wxFONTSTYLE_NORMAL,
-            wxFONTWEIGHT_NORMAL);
-    graphics->SetFont(font, *wxBLACK);
-    graphics->SetPen(*wxBLACK_PEN);
+    graphics->DrawBitmap(mStripBitmap, mStripRect.x, mStripRect.y, mStripRect.width, mStripRect.height);
 
     int top = TickTop;
 
+    //
+    // Draw the pointer
+    //
+    int pw = mPointerImage->GetWidth();
+    int ph = mPointerImage->GetHeight();
+    int x = PointerX();
+    mPointerX = x;
+    graphics->DrawBitmap(mPointerBitmap,
+            x - pw / 2, top,
+            pw, ph
+    );
+}
+
+/**
+ * Draw the tick marks and labels for the visible part
+ * of the timeline into the cached strip bitmap. The bitmap has
+ * a pixel for each device pixel, so it is sharp on high DPI displays.
+ * @param graphics Graphics context the strip will be drawn on
+ * @param timeline The timeline to draw
+ * @param visible The visible area in unscrolled coordinates
+ */
+void ViewTimeline::DrawStrip(std::shared_ptr<wxGraphicsContext> graphics, Timeline *timeline, wxRect visible)
+{
+    mStripRect = visible;
+    mStripFrameRate = timeline->GetFrameRate();
+    mStripNumFrames = timeline->GetNumFrames();
+    mStripScale = graphics->GetContentScaleFactor();
 
-    for (int tickNum = 0; tickNum <= timeline->GetNumFrames(); tickNum++)
-    {
-        int x = BorderLeft + tickNum * TickSpacing;
-        int bottom = top + TickShort;
+    wxImage image(std::max((int)ceil(visible.width * mStripScale), 1),
+            std::max((int)ceil(visible.height * mStripScale), 1));
+    memset(image.GetData(), 255, (size_t)image.GetWidth() * image.GetHeight() * 3);
 
-        bool onSecond = (tickNum % timeline->GetFrameRate()) == 0;
-        if (onSecond)
+    {
+        // The image is only updated when the context is destroyed
+        std::shared_ptr<wxGraphicsContext> strip(wxGraphicsContext::Create(image));
+        strip->Scale(mStripScale, mStripScale);
+        strip->Translate(-visible.x, -visible.y);
+        strip->SetPen(*wxBLACK_PEN);
+
+        // Only the ticks in view, plus enough on each side
+        // for labels that hang into view
+        int first = std::max(0, (visible.GetLeft() - BorderLeft - LabelMargin) / TickSpacing);
+        int last = std::min(timeline->GetNumFrames(),
+                (visible.GetRight() - BorderLeft + LabelMargin) / TickSpacing + 1);
+
+        int top = TickTop;
+        auto ticks = strip->CreatePath();
+        for (int tickNum = first; tickNum <= last; tickNum++)
         {
-            bottom = top + TickLong;
+            int x = BorderLeft + tickNum * TickSpacing;
+            int bottom = top + TickShort;
 
-            // Convert the tick number to seconds in a string
-            std::wstringstream str;
-            str << tickNum / timeline->GetFrameRate();
-            std::wstring wstr = str.str();
+            bool onSecond = (tickNum % mStripFrameRate) == 0;
+            if (onSecond)
+            {
+                bottom = top + TickLong;
 
-            double w, h;
-            graphics->GetTextExtent(wstr, &w, &h);
+                // Convert the tick number to seconds in a string
+                auto label = std::to_wstring(tickNum / mStripFrameRate);
+                mTickLabels.DrawCentered(strip, label, x, bottom + 5);
+            }
 
-            graphics->DrawText(wstr, x - w / 2, bottom + 5);
+            ticks.MoveToPoint(x, bottom);
+            ticks.AddLineToPoint(x, top);
         }
 
-        graphics->StrokeLine(x, bottom, x, top);
+        strip->StrokePath(ticks);
     }
 
-    //
-    // Draw the pointer
-    //
-    int pw = mPointerImage->GetWidth();
-    int ph = mPointerImage->GetHeight();
-    int x = BorderLeft + (int)(timeline->GetCurrentTime() * timeline->GetFrameRate() * TickSpacing);
-    graphics->DrawBitmap(mPointerBitmap,
-            x - pw / 2, top,
-            pw, ph
-    );
+    mStripBitmap = graphics->CreateBitmapFromImage(image);
 }
 
 /**
@@ -228,7 +314,7 @@ void ViewTimeline::OnEditTimelineProperties(wxCommandEvent& event)
     TimelineDlg dlg(this->GetParent(), GetPicture()->GetTimeline());
     if(dlg.ShowModal() == wxID_OK)
     {
-        GetPicture()->UpdateObservers();
+        GetPicture()->UpdateObservers(Picture::TimelineChanged);
     }
 }
 
@@ -269,13 +355,10 @@ void ViewTimeline::OnPlayPlay(wxCommandEvent& event)
         return;
     }
 
-    auto timeline = GetPicture()->GetTimeline();
-
-    auto frameRate = timeline->GetFrameRate();
-    auto time = timeline->GetCurrentTime();
+    auto time = GetPicture()->GetTimeline()->GetCurrentTime();
 
     mStopWatch.Start(lround(time * 1000));
-    mTimer.Start(1000 / frameRate);
+    StartPlayback();
 }
 
 /**
@@ -291,12 +374,49 @@ void ViewTimeline::OnPlayPlayFromBeginning(wxCommandEvent& event)
 
     GetPicture()->SetAnimationTime(0);
 
+    mStopWatch.Start(0);
+    StartPlayback();
+}
+
+/**
+ * Handle a Play>Never Drop Frames menu option
+ * @param event Menu event
+ */
+void ViewTimeline::OnPlayNeverDrop(wxCommandEvent& event)
+{
+    mScheduler.SetNeverDrop(!mScheduler.IsNeverDrop());
+}
+
+/**
+ * Update the user interface for Play>Never Drop Frames
+ * @param event The event we update
+ */
+void ViewTimeline::OnUpdatePlayNeverDrop(wxUpdateUIEvent& event)
+{
+    event.Check(mScheduler.IsNeverDrop());
+}
+
+/**
+ * Start playing from the current frame. The stopwatch
+ * must already be running at the current time.
+ */
+void ViewTimeline::StartPlayback()
+{
     auto timeline = GetPicture()->GetTimeline();
+    mScheduler.Start(timeline->GetCurrentFrame(), mStopWatch.Time() / 1000.0,
+            timeline->GetFrameRate(), timeline->GetNumFrames());
 
-    auto frameRate = timeline->GetFrameRate();
+    mPlaying = true;
+    ScheduleTick();
+}
 
-    mStopWatch.Start(0);
-    mTimer.Start(1000 / frameRate);
+/**
+ * Set the timer to go off when the next frame is due
+ */
+void ViewTimeline::ScheduleTick()
+{
+    long wait = lround((mScheduler.NextDeadline() - mStopWatch.Time() / 1000.0) * 1000);
+    mTimer.StartOnce((int)std::max(1L, wait));
 }
 
 /**
@@ -315,19 +435,27 @@ void ViewTimeline::OnPlayStop(wxCommandEvent& event)
  */
 void ViewTimeline::OnTimer(wxTimerEvent& event)
 {
-    auto timeline = GetPicture()->GetTimeline();
+    if(!mPlaying)
+    {
+        return;
+    }
 
-    auto newTime = mStopWatch.Time() / 1000.0;
-    auto frameRate = timeline->GetFrameRate();
+    // Frames that came due since the last tick and are
+    // skipped here are simulated but never drawn
+    int frame = mScheduler.Tick(mStopWatch.Time() / 1000.0);
+    if(frame != PlaybackScheduler::NoFrame)
+    {
+        auto timeline = GetPicture()->GetTimeline();
+        GetPicture()->SetAnimationTime((double)frame / timeline->GetFrameRate());
+    }
 
-    int frame = (int)lround(newTime * frameRate);
-    if(frame >= timeline->GetNumFrames())
+    if(mScheduler.IsFinished())
     {
-        frame = timeline->GetNumFrames();
         Stop();
+        return;
     }
 
-    GetPicture()->SetAnimationTime(newTime);
+    ScheduleTick();
 }
 
 
@@ -336,6 +464,16 @@ void ViewTimeline::OnTimer(wxTimerEvent& event)
  */
 void ViewTimeline::Stop()
 {
+    if(mPlaying)
+    {
+        auto frame = dynamic_cast<wxFrame *>(GetParent());
+        if(frame != nullptr)
+        {
+            frame->SetStatusText(wxString::Format(L"Played %d frames, %d dropped, %d late",
+                    mScheduler.GetShownFrames(), mScheduler.GetDroppedFrames(), mScheduler.GetLateFrames()));
+        }
+    }
+
     mPlaying = false;
     mTimer.Stop();
     mStopWatch.Pause();
@@ -8,7 +8,11 @@
 #ifndef CANADIANEXPERIENCE_VIEWTIMELINE_H
 #define CANADIANEXPERIENCE_VIEWTIMELINE_H
 
+#include <label-cache-api.h>
 #include "PictureObserver.h"
+#include "PlaybackScheduler.h"
+
+class Timeline;
 
 /**
  * View class for the timeline area of the screen.
@@ -27,6 +31,8 @@ private:
     void OnPlayPlay(wxCommandEvent& event);
     void OnPlayStop(wxCommandEvent& event);
     void OnPlayPlayFromBeginning(wxCommandEvent& event);
+    void OnPlayNeverDrop(wxCommandEvent& event);
+    void OnUpdatePlayNeverDrop(wxUpdateUIEvent& event);
     void OnFileSaveAs(wxCommandEvent& event);
     void OnFileOpen(wxCommandEvent& event);
 
@@ -48,6 +54,36 @@ private:
     /// Are we playing?
     bool mPlaying = false;
 
+    /// Decides which frame to show on each timer tick
+    PlaybackScheduler mScheduler;
+
+    /// Rendered tick mark labels
+    LabelCache mTickLabels;
+
+    /// Cached drawing of the ticks and labels in view
+    wxGraphicsBitmap mStripBitmap;
+
+    /// The visible area mStripBitmap was drawn for, in unscrolled coordinates
+    wxRect mStripRect;
+
+    /// Frame rate mStripBitmap was drawn for
+    int mStripFrameRate = 0;
+
+    /// Number of frames mStripBitmap was drawn for
+    int mStripNumFrames = 0;
+
+    /// Content scale factor mStripBitmap was drawn for
+    double mStripScale = 1;
+
+    /// Unscrolled x of the pointer when it was last drawn, -1 if not drawn yet
+    int mPointerX = -1;
+
+    void DrawStrip(std::shared_ptr<wxGraphicsContext> graphics, Timeline *timeline, wxRect visible);
+    int PointerX();
+    void RefreshPointer(int x);
+    void StartPlayback();
+    void ScheduleTick();
+
 public:
     static const int Height = 90;      ///< Height to make this window
 
@@ -55,6 +91,7 @@ public:
     ViewTimeline(wxFrame* parent, std::wstring imagesDir);
 
     void UpdateObserver() override;
+    void UpdateObserverReasons(int reasons) override;
 
 
 
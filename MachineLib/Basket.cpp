@@ -18,6 +18,10 @@ const auto BaseSize = wxSize(20, 1);
 /// The size of a side of the basket in centimeters
 const auto SideSize = wxSize(5, 20);
 
+/// The size of the area above the base where
+/// a ball is in the basket in centimeters
+const auto InsideSize = wxSize(20, 20);
+
 /// Delay between when the ball hits the basket
 /// and when it is shot out
 const double BasketDelay = 1.0;
@@ -46,15 +50,45 @@ Basket::Basket(const std::wstring &imagesDir) : Component()
 
     mRightSide.BottomCenteredRectangle(SideSize);
     mRightSide.SetColor(*wxGREEN);
+
+    mInside.BottomCenteredRectangle(InsideSize);
+
+    // Hold the first ball that lands until the delay
+    // is up, unless it bounces back out first
+    mInside.SetOnEnter([this](b2Body *ball) {
+        if (mBall == nullptr)
+        {
+            mBall = ball;
+        }
+    });
+
+    mInside.SetOnExit([this](b2Body *ball) {
+        if (ball == mBall)
+        {
+            HoldNextBall(ball);
+        }
+    });
 }
 
 /**
- * Handle a contact beginning
- * @param contact Contact object
+ * Let go of the ball being held and hold the next ball
+ * still inside the basket, if there is one
+ * @param previous The ball let go, which is skipped if it
+ * has not left the basket yet
  */
-void Basket::BeginContact(b2Contact *contact)
+void Basket::HoldNextBall(b2Body *previous)
 {
-    mOccupied = true;
+    mBall = nullptr;
+    mContactDuration = 0;
+
+    for (auto ball : mInside.GetInside())
+    {
+        if (ball != previous)
+        {
+            mBall = ball;
+            break;
+        }
+    }
 }
 
 /**
@@ -63,17 +97,14 @@ void Basket::BeginContact(b2Contact *contact)
  */
 void Basket::Update(double elapsed)
 {
-    if (mOccupied)
+    if (mBall != nullptr)
     {
         mContactDuration += elapsed;
 
         if(mContactDuration >= BasketDelay)
         {
-            auto ball = mBase.GetBody()->GetContactList()->contact->GetFixtureB()->GetBody();
-
-            ball->ApplyLinearImpulseToCenter(BasketImpulse, true);
-
-            Reset();
+            mBall->ApplyLinearImpulseToCenter(BasketImpulse, true);
+            HoldNextBall(mBall);
         }
     }
 }
@@ -82,13 +113,48 @@ void Basket::Update(double elapsed)
  * Draw the this basket's polygon as a texture mapped image.
  * @param graphics
  */
-void Basket::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Basket::Draw(RenderContext &graphics)
 {
     //
     // Draw the image of the basket
     //
     auto rotation = 0; // Rotation is 0 because the basket doesn't turn
-    mBasket.DrawPolygon(graphics, mPosition.m_x, mPosition.m_y, rotation);
+    mBasket.DrawPolygon(graphics.GetGraphics(), mPosition.m_x, mPosition.m_y, rotation);
+}
+
+/**
+ * Draw the basket, which never moves
+ * @param graphics The graphics context object to draw on
+ */
+void Basket::DrawStatic(RenderContext &graphics)
+{
+    Draw(graphics);
+}
+
+/**
+ * The basket has no moving parts to draw
+ * @param graphics The graphics context object to draw on
+ */
+void Basket::DrawDynamic(RenderContext &graphics)
+{
+}
+
+/**
+ * Get the bounds of the basket image
+ * @return Bounds in centimeters
+ */
+wxRect2DDouble Basket::GetStaticBounds()
+{
+    return mBasket.BoundingBox(mPosition.m_x, mPosition.m_y, 0);
+}
+
+/**
+ * The basket never moves
+ * @return true
+ */
+bool Basket::IsStatic()
+{
+    return true;
 }
 
 /**
@@ -100,8 +166,9 @@ void Basket::InstallPhysics(std::shared_ptr<b2World> world)
     mBase.InstallPhysics(world);
     mLeftSide.InstallPhysics(world);
     mRightSide.InstallPhysics(world);
+    mInside.InstallPhysics(world);
 
-    GetMachine()->GetContactListener()->Add(mBase.GetBody(), this);
+    GetMachine()->GetContactListener()->AddTrigger(&mInside, this);
 }
 
 /**
@@ -117,6 +184,7 @@ void Basket::SetPosition(double x, double y)
     mPosition = wxPoint2DDouble(x, y);
 
     mBase.SetInitialPosition(x, y - offset1);
+    mInside.SetInitialPosition(x, y - offset1 + BaseSize.GetHeight());
     mLeftSide.SetInitialPosition(x - offset1, y - offset2);
     mRightSide.SetInitialPosition(x + offset1, y - offset2);
 }
@@ -126,10 +194,35 @@ void Basket::SetPosition(double x, double y)
  */
 void Basket::Reset()
 {
-    mOccupied = false;
+    mBall = nullptr;
     mContactDuration = 0;
+    mInside.Reset();
 }
 
+/**
+ * Get the number of physics bodies this component has installed
+ * @return Number of bodies
+ */
+int Basket::GetBodyCount()
+{
+    int count = 0;
+    for (auto polygon : std::initializer_list<cse335::PhysicsPolygon *>{&mBase, &mLeftSide, &mRightSide, &mInside})
+    {
+        if (polygon->GetBody() != nullptr)
+        {
+            count++;
+        }
+    }
 
+    return count;
+}
 
-
+/**
+ * Get the image files a basket loads
+ * @param imagesDir The images directory
+ * @return Image filenames, named the same way the constructor loads them
+ */
+std::vector<std::wstring> Basket::GetImages(const std::wstring &imagesDir)
+{
+    return {imagesDir + BasketImage};
+}
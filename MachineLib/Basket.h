@@ -8,16 +8,15 @@
 #ifndef CANADIANEXPERIENCE_MACHINELIB_BASKET_H
 #define CANADIANEXPERIENCE_MACHINELIB_BASKET_H
 
-#include <b2_contact.h>
-#include <b2_world_callbacks.h>
 #include "Component.h"
 #include "Polygon.h"
 #include "PhysicsPolygon.h"
+#include "TriggerVolume.h"
 
 /**
  * Class for a basket
  */
-class Basket : public Component, public b2ContactListener
+class Basket final : public Component
 {
 private:
 
@@ -25,22 +24,38 @@ private:
     cse335::PhysicsPolygon mBase;      ///< The base of the basket
     cse335::PhysicsPolygon mLeftSide;  ///< The Left side of the basket
     cse335::PhysicsPolygon mRightSide; ///< The right side of the basket
+    TriggerVolume mInside;             ///< Sensor for a ball inside the basket
 
     double mContactDuration = 0;       ///< How long a ball has been in this basket
-    bool mOccupied = false;            ///< Is a ball currently in this basket ?
+    b2Body *mBall = nullptr;           ///< The ball in this basket, if any
 
     wxPoint2DDouble mPosition = wxPoint2DDouble(0, 0); ///< The location of the basket
 
+    void HoldNextBall(b2Body *previous);
+
 public:
 
     Basket(const std::wstring &imagesDir);
 
+    static std::vector<std::wstring> GetImages(const std::wstring &imagesDir);
+
     void Reset() override;
-    void Update(double elapsed) override;
-    void BeginContact(b2Contact *contact);
+    void Update(double elapsed);
     void SetPosition(double x, double y) override;
     void InstallPhysics(std::shared_ptr<b2World> world) override;
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
+    void DrawStatic(RenderContext &graphics) override;
+    void DrawDynamic(RenderContext &graphics) override;
+    wxRect2DDouble GetStaticBounds() override;
+    bool IsStatic() override;
+
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Basket"; }
+
+    int GetBodyCount() override;
 
     /// Default constructor (disabled)
     Basket() = delete;
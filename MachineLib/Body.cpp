@@ -18,9 +18,51 @@ Body::Body() : Component()
  * Draw this body
  * @param graphics The graphics context object to draw on
  */
-void Body::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Body::Draw(RenderContext &graphics)
 {
-    mBody.Draw(graphics);
+    mBody.Draw(graphics.GetGraphics());
+}
+
+/**
+ * Draw this body if it is a static body
+ * @param graphics The graphics context object to draw on
+ */
+void Body::DrawStatic(RenderContext &graphics)
+{
+    if (mBody.IsStatic())
+    {
+        mBody.Draw(graphics.GetGraphics());
+    }
+}
+
+/**
+ * Draw this body if it is not a static body
+ * @param graphics The graphics context object to draw on
+ */
+void Body::DrawDynamic(RenderContext &graphics)
+{
+    if (!mBody.IsStatic())
+    {
+        mBody.Draw(graphics.GetGraphics());
+    }
+}
+
+/**
+ * Get the bounds of this body if it is a static body
+ * @return Bounds in centimeters, empty if the body can move
+ */
+wxRect2DDouble Body::GetStaticBounds()
+{
+    return mBody.IsStatic() ? mBody.PlacedBoundingBox() : wxRect2DDouble();
+}
+
+/**
+ * Is this body a static body that never moves?
+ * @return true if static
+ */
+bool Body::IsStatic()
+{
+    return mBody.IsStatic();
 }
 
 
@@ -155,15 +197,6 @@ void Body::InstallPhysics(std::shared_ptr<b2World> world)
     mBody.InstallPhysics(world);
 }
 
-/**
- * Update the time of this body
- * @param elapsed The time elapsed
- */
-void Body::Update(double elapsed)
-{
-
-}
-
 /**
  * Rotate this body using the rotation speed of its rotation source
  * @param rotation The new rotation
@@ -191,6 +224,11 @@ void Body::Reset()
     mBody.SetAngularVelocity(0);
 }
 
-
-
-
+/**
+ * Get the number of physics bodies this component has installed
+ * @return Number of bodies
+ */
+int Body::GetBodyCount()
+{
+    return mBody.GetBody() != nullptr ? 1 : 0;
+}
@@ -15,7 +15,7 @@
 /**
  * Class for a body in a machine
  */
-class Body : public Component
+class Body final : public Component
 {
 private:
 
@@ -38,12 +38,23 @@ public:
 
     void Reset() override;
     void AddPoint(double x, double y);
-    void Update(double elapsed) override;
     void Rotate(double rotation, double speed) override;
     void Circle(double radius, int steps=32);
     void BottomCenteredRectangle(double width, double height);
     void Rectangle(double x, double y, double width, double height);
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
+    void DrawStatic(RenderContext &graphics) override;
+    void DrawDynamic(RenderContext &graphics) override;
+    wxRect2DDouble GetStaticBounds() override;
+    bool IsStatic() override;
+
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Body"; }
+
+    int GetBodyCount() override;
 
     /// Copy constructor (disabled)
     Body(const Body &) = delete;
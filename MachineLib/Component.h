@@ -11,6 +11,9 @@
 #include "PhysicsPolygon.h"
 #include "ContactListener.h"
 #include "Machine.h"
+#include "RenderContext.h"
+
+class RotationSource;
 
 /**
  * Base class for a component of a machine
@@ -41,17 +44,56 @@ public:
      */
     virtual void Rotate(double rotation, double speed) {};
 
+    /**
+     * Get the rotation source of this component
+     * @return Rotation source, nullptr if this component drives nothing
+     */
+    virtual RotationSource *GetSource() { return nullptr; }
+
     /**
      * Draw this component
      * @param graphics The graphics context object to draw on
      */
-    virtual void Draw(std::shared_ptr<wxGraphicsContext> graphics) = 0;
+    virtual void Draw(RenderContext &graphics) = 0;
+
+    /**
+     * Draw the parts of this component that never move.
+     *
+     * These are drawn into a cached static layer, so they
+     * must not depend on the machine time.
+     * @param graphics The graphics context object to draw on
+     */
+    virtual void DrawStatic(RenderContext &graphics) {}
+
+    /**
+     * Draw the parts of this component that are not drawn by DrawStatic
+     * @param graphics The graphics context object to draw on
+     */
+    virtual void DrawDynamic(RenderContext &graphics) { Draw(graphics); }
+
+    /**
+     * Get the bounds of what DrawStatic draws
+     * @return Bounds in centimeters, empty if there are no static parts
+     */
+    virtual wxRect2DDouble GetStaticBounds() { return wxRect2DDouble(); }
+
+    /**
+     * Is all of this component drawn by DrawStatic?
+     * @return true if there is nothing to draw in DrawDynamic
+     */
+    virtual bool IsStatic() { return false; }
+
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    virtual std::wstring GetTypeName() const { return L"Component"; }
 
     /**
-     * Update the time of this component
-     * @param elapsed The time elapsed
+     * Get the number of physics bodies this component has installed
+     * @return Number of bodies
      */
-    virtual void Update(double elapsed) {}
+    virtual int GetBodyCount() { return 0; }
 
     /**
      * Get the current time of this component
@@ -0,0 +1,51 @@
+/**
+ * @file ComponentStats.h
+ * @author Mate Narh
+ *
+ * Timing and counters for one component of a machine.
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_COMPONENTSTATS_H
+#define CANADIANEXPERIENCE_MACHINELIB_COMPONENTSTATS_H
+
+#include <string>
+
+/**
+ * Timing and counters for one component of a machine.
+ *
+ * Times are in milliseconds. Totals are since the machine
+ * was created or its stats were last cleared. Cached static
+ * layers are reported as components of type StaticLayer,
+ * since their drawing replaces the drawing of the static
+ * parts of the components in them.
+ */
+struct ComponentStats
+{
+    std::wstring mType;         ///< Component type name
+    int mInstance = 0;          ///< Index among the components of this type
+
+    double mUpdateLast = 0;     ///< Time of the last Update
+    double mUpdateTotal = 0;    ///< Time of all Update calls
+    long mUpdates = 0;          ///< Number of Update calls
+
+    double mDrawLast = 0;       ///< Time of the last draw
+    double mDrawTotal = 0;      ///< Time of all draws
+    long mDraws = 0;            ///< Number of draws
+
+    long mContacts = 0;         ///< Contact callbacks dispatched for the component
+    int mBodies = 0;            ///< Physics bodies the component has installed
+
+    /**
+     * Record the time of an Update call
+     * @param time Time in milliseconds
+     */
+    void RecordUpdate(double time) { mUpdateLast = time; mUpdateTotal += time; mUpdates++; }
+
+    /**
+     * Record the time of a draw
+     * @param time Time in milliseconds
+     */
+    void RecordDraw(double time) { mDrawLast = time; mDrawTotal += time; mDraws++; }
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_COMPONENTSTATS_H
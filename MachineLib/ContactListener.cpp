@@ -7,6 +7,58 @@
 #include <b2_contact.h>
 
 #include "ContactListener.h"
+#include "TriggerVolume.h"
+
+/**
+ * Add a dispatched listener for some body.
+ *
+ * The body's user data points at the dispatch record, so a
+ * contact finds its listener without a lookup. The bodies are
+ * destroyed with their world before this listener is replaced.
+ *
+ * @param body Body to listen for
+ * @param listener Listener to call
+ * @param owner Component the contacts are counted for in its stats
+ */
+void ContactListener::Add(b2Body *body, b2ContactListener *listener, Component *owner)
+{
+    auto dispatch = GetDispatch(body);
+    if (dispatch == nullptr)
+    {
+        mDispatch.emplace_back();
+        dispatch = &mDispatch.back();
+        body->GetUserData().pointer = reinterpret_cast<uintptr_t>(dispatch);
+    }
+
+    dispatch->mListener = listener;
+    dispatch->mOwner = owner;
+}
+
+/**
+ * Add a trigger volume. It is dispatched to like any other
+ * listener, and its queued events are drained after each step.
+ *
+ * Must be called after the trigger is installed in the physics system.
+ * @param trigger Trigger volume to add
+ * @param owner Component the trigger's contacts are counted for
+ */
+void ContactListener::AddTrigger(TriggerVolume *trigger, Component *owner)
+{
+    Add(trigger->GetBody(), trigger, owner);
+    mTriggers.push_back(trigger);
+}
+
+/**
+ * Hand the events queued during the last step to the trigger
+ * volumes' owners. Call after each b2World::Step.
+ */
+void ContactListener::DrainTriggers()
+{
+    for (auto trigger : mTriggers)
+    {
+        trigger->Drain();
+    }
+}
 
 /**
  * Handle a contact beginning
@@ -14,63 +66,99 @@
  */
 void ContactListener::BeginContact(b2Contact *contact)
 {
-    b2ContactListener* listener = nullptr;
-    if(ShouldDispatch(contact, 1, listener))
+    auto dispatchA = GetDispatch(contact->GetFixtureA()->GetBody());
+    auto dispatchB = GetDispatch(contact->GetFixtureB()->GetBody());
+
+    if (dispatchA != nullptr)
     {
-        listener->BeginContact(contact);
+        dispatchA->mContacts++;
+        dispatchA->mListener->BeginContact(contact);
     }
 
-    if(ShouldDispatch(contact, 2, listener))
+    if (dispatchB != nullptr)
     {
-        listener->BeginContact(contact);
+        dispatchB->mContacts++;
+        dispatchB->mListener->BeginContact(contact);
     }
 }
 
 /**
- * This function is called before the contact occurs
+ * Handle the end of a contact situation
  * @param contact Contact object
- * @param oldManifold A manifold object
  */
-void ContactListener::PreSolve(b2Contact *contact, const b2Manifold *oldManifold)
+void ContactListener::EndContact(b2Contact *contact)
 {
-    b2ContactListener* listener = nullptr;
-    if(ShouldDispatch(contact, 1, listener))
+    auto dispatchA = GetDispatch(contact->GetFixtureA()->GetBody());
+    auto dispatchB = GetDispatch(contact->GetFixtureB()->GetBody());
+
+    if (dispatchA != nullptr)
     {
-        listener->PreSolve(contact, oldManifold);
+        dispatchA->mContacts++;
+        dispatchA->mListener->EndContact(contact);
     }
 
-    if(ShouldDispatch(contact, 2, listener))
+    if (dispatchB != nullptr)
     {
-        listener->PreSolve(contact, oldManifold);
+        dispatchB->mContacts++;
+        dispatchB->mListener->EndContact(contact);
     }
 }
 
 /**
- * Should a contact be dispatched to an installed listener for some body?
+ * This function is called before the contact occurs
  *
- * We have installed listeners in mDispatch for bodies. This tests to see
- * if either of the two bodies involved  in the collision are in the
- * mDispatch map. If so, the listener reference value is set and a
- * true value is returned.
+ * This is called for every touching pair on every step,
+ * so pairs nobody listens to cost only two loads.
  *
- * @param contact Contact to test
- * @param body Which body for the contact (1 or 2?)
- * @param listener Where to put the listener to call the function on
- * @return true if we should dispatch this contact
+ * @param contact Contact object
+ * @param oldManifold A manifold object
  */
- bool ContactListener::ShouldDispatch(b2Contact *contact, int body, b2ContactListener* &listener)
+void ContactListener::PreSolve(b2Contact *contact, const b2Manifold *oldManifold)
 {
-    b2Body* bodyD = body == 1 ? contact->GetFixtureA()->GetBody() :
-                               contact->GetFixtureB()->GetBody();
+    auto dispatchA = GetDispatch(contact->GetFixtureA()->GetBody());
+    auto dispatchB = GetDispatch(contact->GetFixtureB()->GetBody());
+
+    if (dispatchA != nullptr)
+    {
+        dispatchA->mContacts++;
+        dispatchA->mListener->PreSolve(contact, oldManifold);
+    }
+
+    if (dispatchB != nullptr)
+    {
+        dispatchB->mContacts++;
+        dispatchB->mListener->PreSolve(contact, oldManifold);
+    }
+}
 
-    auto dispatchA = mDispatch.find(bodyD);
-    if(dispatchA != mDispatch.end())
+/**
+ * Get the number of contact callbacks dispatched for a component
+ * @param owner Component to count for
+ * @return Number of callbacks over all of the bodies it owns
+ */
+long ContactListener::GetContactCount(Component* owner) const
+{
+    long count = 0;
+    for (auto &dispatch : mDispatch)
     {
-       listener = dispatchA->second;
-       return true;
+        if (dispatch.mOwner == owner)
+        {
+            count += dispatch.mContacts;
+        }
     }
 
-    return false;
+    return count;
+}
+
+/**
+ * Set the number of contact callbacks dispatched back to zero
+ */
+void ContactListener::ClearContactCounts()
+{
+    for (auto &dispatch : mDispatch)
+    {
+        dispatch.mContacts = 0;
+    }
 }
 
 
@@ -9,8 +9,12 @@
 #ifndef CANADIANEXPERIENCE_MACHINELIB_CONTACTLISTENER_H
 #define CANADIANEXPERIENCE_MACHINELIB_CONTACTLISTENER_H
 
-#include <map>
+#include <deque>
 #include <b2_world_callbacks.h>
+#include <b2_body.h>
+
+class TriggerVolume;
+class Component;
 
 /**
  * A contact filter allows for testing for things
@@ -19,30 +23,44 @@
 class ContactListener : public b2ContactListener
 {
 private:
+    /// Where contacts for a body are dispatched
+    struct Dispatch
+    {
+        b2ContactListener *mListener = nullptr; ///< Listener to call
+        Component *mOwner = nullptr;            ///< Component the contacts are counted for
+        long mContacts = 0;                     ///< Number of callbacks dispatched
+    };
+
     /**
-     * Keep track of bodies we want to dispatch
-     * the contact listener to.
+     * Where contacts are dispatched for each body we listen to.
+     * A deque, so the records stay where the bodies point to them.
      */
-    std::map<b2Body*, b2ContactListener*> mDispatch;
+    std::deque<Dispatch> mDispatch;
 
-    bool ShouldDispatch(b2Contact *contact, int body, b2ContactListener* &listener);
+    /// Trigger volumes to drain after each step
+    std::vector<TriggerVolume *> mTriggers;
 
-public:
     /**
-     * Add a dispatched listener for some body.
-     * @param body Body to listen for
-     * @param listener Listener to call
+     * Get where contacts for a body are dispatched
+     * @param body Body to look up
+     * @return Dispatch record, nullptr if nothing listens to this body
      */
-    void Add(b2Body* body, b2ContactListener* listener) {mDispatch[body] = listener;}
+    static Dispatch *GetDispatch(b2Body *body)
+    {
+        return reinterpret_cast<Dispatch *>(body->GetUserData().pointer);
+    }
+
+public:
+    void Add(b2Body* body, b2ContactListener* listener, Component* owner = nullptr);
+    void AddTrigger(TriggerVolume* trigger, Component* owner = nullptr);
+    void DrainTriggers();
+
+    long GetContactCount(Component* owner) const;
+    void ClearContactCounts();
 
     void BeginContact(b2Contact* contact) override;
 
-    /**
-     * Handle the end of a contact situation
-     * @param contact Contact object
-     */
-    void EndContact(b2Contact* contact) override
-    { /* handle end event */ }
+    void EndContact(b2Contact* contact) override;
 
     void PreSolve(b2Contact* contact, const b2Manifold* oldManifold) override;
 
@@ -4,7 +4,9 @@
  */
 
 #include "pch.h"
+#include <algorithm>
 #include <b2_contact.h>
+#include <b2_fixture.h>
 #include "Conveyor.h"
 
 /// The offset from the bottom center of the conveyor
@@ -31,23 +33,82 @@ Conveyor::Conveyor(const std::wstring &imagesDir) : Component()
 
 /**
  * Update the animation of this conveyor and its associations
- * If there are objects on the surface of the conveyor, cause
- * them to move linearly at the speed of the conveyor
+ *
+ * Bodies on the surface of the conveyor are set moving linearly
+ * at the speed of the conveyor when they get on and whenever the
+ * speed changes. In between, the belt carries them along through
+ * the tangent speed set in PreSolve.
  * @param elapsed The new time
  */
 void Conveyor::Update(double elapsed)
 {
-    //
-    // Translate every body on the conveyor
-    //
-    auto contact = mConveyor.GetBody()->GetContactList();
-    while(contact != nullptr)
+    if (mSpeed != mAppliedSpeed)
     {
-        if(contact->contact->IsTouching())
+        //
+        // Translate every body on the conveyor
+        //
+        for (auto &rider : mRiders)
         {
-            contact->other->SetLinearVelocity(b2Vec2(-mSpeed, 0));
+            Drive(rider.first);
         }
-        contact = contact->next;
+
+        mAppliedSpeed = mSpeed;
+    }
+    else
+    {
+        for (auto body : mJoined)
+        {
+            Drive(body);
+        }
+    }
+
+    mJoined.clear();
+}
+
+/**
+ * Set a body moving at the speed of the conveyor
+ * @param body Body riding the conveyor
+ */
+void Conveyor::Drive(b2Body *body)
+{
+    body->SetLinearVelocity(b2Vec2(-mSpeed, 0));
+}
+
+/**
+ * Handle a body touching the conveyor
+ * @param contact Contact object
+ */
+void Conveyor::BeginContact(b2Contact *contact)
+{
+    auto body = contact->GetFixtureA()->GetBody();
+    if (body == mConveyor.GetBody())
+    {
+        body = contact->GetFixtureB()->GetBody();
+    }
+
+    if (mRiders[body]++ == 0)
+    {
+        mJoined.push_back(body);
+    }
+}
+
+/**
+ * Handle a body no longer touching the conveyor
+ * @param contact Contact object
+ */
+void Conveyor::EndContact(b2Contact *contact)
+{
+    auto body = contact->GetFixtureA()->GetBody();
+    if (body == mConveyor.GetBody())
+    {
+        body = contact->GetFixtureB()->GetBody();
+    }
+
+    auto rider = mRiders.find(body);
+    if (rider != mRiders.end() && --rider->second == 0)
+    {
+        mRiders.erase(rider);
+        mJoined.erase(std::remove(mJoined.begin(), mJoined.end(), body), mJoined.end());
     }
 }
 
@@ -55,9 +116,45 @@ void Conveyor::Update(double elapsed)
  * Draw this conveyor
  * @param graphics The graphics context object to draw on
  */
-void Conveyor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Conveyor::Draw(RenderContext &graphics)
+{
+    mConveyor.Draw(graphics.GetGraphics());
+}
+
+/**
+ * Draw the conveyor. The belt motion is only in the
+ * physics, so the image never moves.
+ * @param graphics The graphics context object to draw on
+ */
+void Conveyor::DrawStatic(RenderContext &graphics)
+{
+    mConveyor.Draw(graphics.GetGraphics());
+}
+
+/**
+ * The conveyor has no moving parts to draw
+ * @param graphics The graphics context object to draw on
+ */
+void Conveyor::DrawDynamic(RenderContext &graphics)
+{
+}
+
+/**
+ * Get the bounds of the conveyor image
+ * @return Bounds in centimeters
+ */
+wxRect2DDouble Conveyor::GetStaticBounds()
+{
+    return mConveyor.PlacedBoundingBox();
+}
+
+/**
+ * The conveyor image never moves
+ * @return true
+ */
+bool Conveyor::IsStatic()
 {
-    mConveyor.Draw(graphics);
+    return true;
 }
 
 /**
@@ -67,7 +164,7 @@ void Conveyor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 void Conveyor::InstallPhysics(std::shared_ptr<b2World> world)
 {
     mConveyor.InstallPhysics(world);
-    GetMachine()->GetContactListener()->Add(mConveyor.GetBody(), this);
+    GetMachine()->GetContactListener()->Add(mConveyor.GetBody(), this, this);
 }
 
 /**
@@ -136,5 +233,26 @@ void Conveyor::PreSolve(b2Contact *contact, const b2Manifold *oldManifold)
 void Conveyor::Reset()
 {
     mSpeed = 0;
+    mAppliedSpeed = 0;
+    mRiders.clear();
+    mJoined.clear();
+}
+
+/**
+ * Get the number of physics bodies this component has installed
+ * @return Number of bodies
+ */
+int Conveyor::GetBodyCount()
+{
+    return mConveyor.GetBody() != nullptr ? 1 : 0;
 }
 
+/**
+ * Get the image files a conveyor loads
+ * @param imagesDir The images directory
+ * @return Image filenames, named the same way the constructor loads them
+ */
+std::vector<std::wstring> Conveyor::GetImages(const std::wstring &imagesDir)
+{
+    return {imagesDir + ConveyorImageName};
+}
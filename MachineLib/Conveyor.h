@@ -12,6 +12,7 @@
 #ifndef CANADIANEXPERIENCE_MACHINELIB_CONVEYOR_H
 #define CANADIANEXPERIENCE_MACHINELIB_CONVEYOR_H
 
+#include <map>
 #include <b2_world_callbacks.h>
 #include "Component.h"
 #include "PhysicsPolygon.h"
@@ -20,7 +21,7 @@
 /**
  * Class for a conveyor
  */
-class Conveyor : public Component, public b2ContactListener
+class Conveyor final : public Component, public b2ContactListener
 {
 private:
     /// The encapsulated physics polygon for this conveyor
@@ -35,21 +36,55 @@ private:
     /// The speed of this conveyor
     double mSpeed = 0.0;
 
+    /// The speed last applied to the bodies riding the conveyor
+    double mAppliedSpeed = 0.0;
+
+    /// Bodies riding the conveyor, with the number
+    /// of contacts each has with the belt
+    std::map<b2Body *, int> mRiders;
+
+    /// Bodies that got on since the last update
+    std::vector<b2Body *> mJoined;
+
+    void Drive(b2Body *body);
+
 public:
 
     Conveyor(const std::wstring &imagesDir);
 
+    static std::vector<std::wstring> GetImages(const std::wstring &imagesDir);
+
     wxPoint2DDouble GetPosition();
     wxPoint2DDouble GetShaftPosition();
 
     void Reset() override;
-    void Update(double elapsed) override;
+    void Update(double elapsed);
     void SetPosition(double x, double y) override;
     void SetPosition(wxPoint2DDouble position) override;
     void Rotate(double rotation, double speed) override;
     void InstallPhysics(std::shared_ptr<b2World> world) override;
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
-    void PreSolve(b2Contact *contact, const b2Manifold *oldManifold);
+    void Draw(RenderContext &graphics) override;
+    void DrawStatic(RenderContext &graphics) override;
+    void DrawDynamic(RenderContext &graphics) override;
+    wxRect2DDouble GetStaticBounds() override;
+    bool IsStatic() override;
+
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Conveyor"; }
+
+    int GetBodyCount() override;
+    void BeginContact(b2Contact *contact) override;
+    void EndContact(b2Contact *contact) override;
+    void PreSolve(b2Contact *contact, const b2Manifold *oldManifold) override;
+
+    /**
+     * Get the number of bodies riding the conveyor
+     * @return Number of bodies
+     */
+    int GetNumRiders() const { return (int)mRiders.size(); }
 
 };
 
@@ -66,37 +66,48 @@ void Curtain::Reset()
 
 
 /**
- * Update the time of this curtain
- * @param elapsed The time elapsed
+ * Draw this curtain
+ * @param graphics The graphics context object to draw on
  */
-void Curtain::Update(double elapsed)
+void Curtain::Draw(RenderContext &graphics)
 {
+    DrawStatic(graphics);
+    DrawDynamic(graphics);
+}
 
+/**
+ * Draw the rod, which never moves
+ * @param graphics The graphics context object to draw on
+ */
+void Curtain::DrawStatic(RenderContext &graphics)
+{
+    mRod.DrawPolygon(graphics.GetGraphics(), mRodPos.m_x, mRodPos.m_y, CurtainRotation);
 }
 
 /**
- * Draw the rod beneath the left and right curtain
+ * Draw the left curtain and the right curtain
  * @param graphics The graphics context object to draw on
  */
-void Curtain::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Curtain::DrawDynamic(RenderContext &graphics)
 {
     //
     // First : Reset the state of the curtains
     //
     ResetCurtainState();
 
-    //
-    // Draw the rod
-    //
-    mRod.DrawPolygon(graphics, mRodPos.m_x, mRodPos.m_y, CurtainRotation);
-
-    //
-    // Draw the left curtain and the right curtain
-    //
     DrawCurtains(graphics);
     mPreviousTime = GetMachine()->GetMachineTime();
 }
 
+/**
+ * Get the bounds of the rod
+ * @return Bounds in centimeters
+ */
+wxRect2DDouble Curtain::GetStaticBounds()
+{
+    return mRod.BoundingBox(mRodPos.m_x, mRodPos.m_y, CurtainRotation);
+}
+
 /**
  * Set the position of this curtain
  * @param x The new horizontal location
@@ -113,7 +124,7 @@ void Curtain::SetPosition(double x, double y)
  * Draw the left and right curtain only
  * @param graphics The graphics context object to draw on
  */
-void Curtain::DrawCurtains(std::shared_ptr<wxGraphicsContext> graphics)
+void Curtain::DrawCurtains(RenderContext &graphics)
 {
     auto wid = CurtainWidth / 2;
     auto residue = 1 - mXScale;
@@ -124,7 +135,7 @@ void Curtain::DrawCurtains(std::shared_ptr<wxGraphicsContext> graphics)
     graphics->PushState();
     graphics->Translate( -residue * wid, 1 );
     graphics->Scale(mXScale, 1);
-    mLeftCurtain.DrawPolygon(graphics, mLeftPos.m_x, mLeftPos.m_y, CurtainRotation);
+    mLeftCurtain.DrawPolygon(graphics.GetGraphics(), mLeftPos.m_x, mLeftPos.m_y, CurtainRotation);
     graphics->PopState();
 
     //
@@ -133,7 +144,7 @@ void Curtain::DrawCurtains(std::shared_ptr<wxGraphicsContext> graphics)
     graphics->PushState();
     graphics->Translate( residue * wid, 1 );
     graphics->Scale(mXScale, 1);
-    mRightCurtain.DrawPolygon(graphics,  mRightPos.m_x, mRightPos.m_y, CurtainRotation);
+    mRightCurtain.DrawPolygon(graphics.GetGraphics(),  mRightPos.m_x, mRightPos.m_y, CurtainRotation);
     graphics->PopState();
 }
 
@@ -209,5 +220,14 @@ void Curtain::ResetCurtainState()
     }
 }
 
-
-
+/**
+ * Get the image files a curtain loads
+ * @param imagesDir The images directory
+ * @return Image filenames, named the same way the constructor loads them
+ */
+std::vector<std::wstring> Curtain::GetImages(const std::wstring &imagesDir)
+{
+    return {imagesDir + CurtainRod,
+            imagesDir + LeftCurtain,
+            imagesDir + RightCurtain};
+}
@@ -14,7 +14,7 @@
 /**
  * Class for a curtain
  */
-class Curtain : public Component
+class Curtain final : public Component
 {
 private:
 
@@ -45,12 +45,22 @@ public:
 
     Curtain(const std::wstring &imagesDir);
 
+    static std::vector<std::wstring> GetImages(const std::wstring &imagesDir);
+
     void Reset() override;
     void ResetCurtainState();
-    void Update(double elapsed) override;
     void SetPosition(double x, double y) override;
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
-    void DrawCurtains(std::shared_ptr<wxGraphicsContext> graphics);
+    void Draw(RenderContext &graphics) override;
+    void DrawStatic(RenderContext &graphics) override;
+    void DrawDynamic(RenderContext &graphics) override;
+    wxRect2DDouble GetStaticBounds() override;
+
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Curtain"; }
+    void DrawCurtains(RenderContext &graphics);
 
     /// Copy constructor (disabled)
     Curtain(const Curtain &) = delete;
@@ -6,15 +6,15 @@
 #include "pch.h"
 #include "DebugDraw.h"
 #include "Consts.h"
+#include "RenderContext.h"
 
 
 /**
  * Constructor
  * @param graphics Graphics content to draw on
  */
-DebugDraw::DebugDraw(std::shared_ptr<wxGraphicsContext> graphics)
+DebugDraw::DebugDraw(RenderContext &graphics) : mGraphics(graphics)
 {
-    mGraphics = graphics;
 }
 
 
@@ -30,7 +30,7 @@ DebugDraw::DebugDraw(std::shared_ptr<wxGraphicsContext> graphics)
 void DebugDraw::DrawCircle (const b2Vec2 &center, float radius, const b2Color &color)
 {
     SetPenColor(color);
-    mGraphics->SetBrush(wxNullBrush);
+    mGraphics.SetTransparentBrush();
 
     double x = center.x * Consts::MtoCM;
     double y = center.y * Consts::MtoCM;
@@ -72,8 +72,8 @@ void DebugDraw::DrawPolygon(const b2Vec2 *vertices, int32 vertexCount, const b2C
 
     mGraphics->PushState();
     mGraphics->Scale(1.0/mFineLine, 1.0/mFineLine);
-    mGraphics->SetPen(*wxRED_PEN);
-    mGraphics->SetBrush(wxNullBrush);
+    mGraphics.SetPen(*wxRED);
+    mGraphics.SetTransparentBrush();
     mGraphics->StrokePath(path);
     mGraphics->PopState();
 }
@@ -135,12 +135,12 @@ void DebugDraw::DrawTransform(const b2Transform &xf)
     mGraphics->Scale(1.0/mFineLine, 1.0/mFineLine);
 
     // Draw all but the direction to the right
-    mGraphics->SetPen(*wxRED_PEN);
+    mGraphics.SetPen(*wxRED);
     mGraphics->StrokeLine(x - c, y - s, x, y);
     mGraphics->StrokeLine(x + s, y - c, x - s, y + c);
 
     // Draw that last part to the right in a different color
-    mGraphics->SetPen(*wxGREEN_PEN);
+    mGraphics.SetPen(*wxGREEN);
     mGraphics->StrokeLine(x, y, x + c, y + s);
 
     mGraphics->PopState();
@@ -154,8 +154,7 @@ void DebugDraw::DrawTransform(const b2Transform &xf)
 void DebugDraw::SetPenColor(const b2Color &color, int width)
 {
     wxColour clr(int(color.r*255), int(color.g*255), int(color.b*255), int(color.a*255));
-    wxPen pen(clr, width);
-    mGraphics->SetPen(pen);
+    mGraphics.SetPen(clr, width);
 }
 
 /**
@@ -174,7 +173,7 @@ void DebugDraw::DrawSegment(const b2Vec2& p1, const b2Vec2& p2, const b2Color& c
     auto x2 = p2.x * Consts::MtoCM;
     auto y2 = p2.y * Consts::MtoCM;
 
-    mGraphics->SetPen(*wxRED_PEN);
+    mGraphics.SetPen(*wxRED);
     mGraphics->StrokeLine(x1, y1, x2, y2);
 }
 
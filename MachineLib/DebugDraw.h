@@ -6,6 +6,7 @@
  * of the physics system.
  *
  * @version 2.00 Updated to support finer lines
+ * @version 2.01 Draws through a RenderContext with pooled pens
  */
 
 #ifndef _DEBUGDRAW_H
@@ -13,13 +14,15 @@
 
 #include <b2_draw.h>
 
+class RenderContext;
+
 /**
  * Debugging support to draw the world from the viewpoint of the physics system.
  */
 class DebugDraw : public b2Draw {
 private:
     /// Graphics context to draw on
-    std::shared_ptr<wxGraphicsContext> mGraphics;
+    RenderContext &mGraphics;
 
     void SetPenColor(const b2Color& color, int width=1);
 
@@ -31,7 +34,7 @@ private:
     double mFineLine = 1;
 
 public:
-    DebugDraw(std::shared_ptr<wxGraphicsContext> graphics);
+    DebugDraw(RenderContext &graphics);
 
     /// Default constructor (disabled)
     DebugDraw() = delete;
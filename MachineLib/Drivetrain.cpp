@@ -0,0 +1,97 @@
+/**
+ * @file Drivetrain.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <map>
+#include "Drivetrain.h"
+#include "Component.h"
+#include "RotationSource.h"
+
+/**
+ * Build the list of links from the components of a machine
+ * @param components Components in the order they were added
+ */
+void Drivetrain::Build(const std::vector<std::shared_ptr<Component>> &components)
+{
+    mLinks.clear();
+    mLooped = 0;
+
+    //
+    // Count the links into each component
+    //
+    std::map<Component *, int> inbound;
+    for (auto &component : components)
+    {
+        auto source = component->GetSource();
+        if (source != nullptr)
+        {
+            for (auto &sink : source->GetSinks())
+            {
+                inbound[sink.mComponent.get()]++;
+            }
+        }
+    }
+
+    //
+    // Start from the sources nothing drives, and add a
+    // component's links once every link into it is added
+    //
+    std::vector<Component *> ready;
+    for (auto &component : components)
+    {
+        if (component->GetSource() != nullptr && inbound[component.get()] == 0)
+        {
+            ready.push_back(component.get());
+        }
+    }
+
+    std::map<Component *, bool> added;
+    for (size_t i = 0; i < ready.size(); i++)
+    {
+        auto source = ready[i]->GetSource();
+        added[ready[i]] = true;
+        for (auto &sink : source->GetSinks())
+        {
+            auto component = sink.mComponent.get();
+            mLinks.push_back({source, component, sink.mRatio});
+            if (--inbound[component] == 0 && component->GetSource() != nullptr)
+            {
+                ready.push_back(component);
+            }
+        }
+    }
+
+    //
+    // Anything left is driven around a loop, so there
+    // is no order that turns it in the same frame
+    //
+    for (auto &component : components)
+    {
+        auto source = component->GetSource();
+        if (source != nullptr && !added[component.get()])
+        {
+            for (auto &sink : source->GetSinks())
+            {
+                mLinks.push_back({source, sink.mComponent.get(), sink.mRatio});
+                mLooped++;
+            }
+        }
+    }
+}
+
+/**
+ * Pass the rotation of every driving source on to its sinks
+ */
+void Drivetrain::Rotate()
+{
+    for (auto &link : mLinks)
+    {
+        if (link.mSource->IsDriving())
+        {
+            link.mSink->Rotate(link.mSource->GetRotation() * link.mRatio,
+                    link.mSource->GetSpeed() * link.mRatio);
+        }
+    }
+}
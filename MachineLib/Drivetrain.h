@@ -0,0 +1,67 @@
+/**
+ * @file Drivetrain.h
+ * @author Mate Narh
+ *
+ * The rotation sources and sinks of a machine, in the order they turn
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_DRIVETRAIN_H
+#define CANADIANEXPERIENCE_MACHINELIB_DRIVETRAIN_H
+
+class Component;
+class RotationSource;
+
+/**
+ * The rotation sources and sinks of a machine, in the order they turn.
+ *
+ * Every source to sink link is put in one list, sorted so that
+ * a link comes after every link that drives its source. Turning
+ * the list once per frame carries a hamster's rotation down any
+ * length of belts in the same frame.
+ */
+class Drivetrain
+{
+private:
+    /**
+     * One source driving one sink
+     */
+    struct Link
+    {
+        RotationSource *mSource = nullptr; ///< The driving source
+        Component *mSink = nullptr;        ///< The driven component
+        double mRatio = 1;                 ///< Sink rotation per unit of source rotation
+    };
+
+    /// The links in the order they are evaluated
+    std::vector<Link> mLinks;
+
+    /// Number of links that could not be ordered because they form a loop
+    int mLooped = 0;
+
+public:
+    Drivetrain() {}
+
+    /// Copy constructor (disabled)
+    Drivetrain(const Drivetrain &) = delete;
+
+    /// Assignment operator
+    void operator=(const Drivetrain &) = delete;
+
+    void Build(const std::vector<std::shared_ptr<Component>> &components);
+    void Rotate();
+
+    /**
+     * Get the number of source to sink links
+     * @return Number of links
+     */
+    int GetNumLinks() const { return (int)mLinks.size(); }
+
+    /**
+     * Get the number of links that are part of a loop. These are
+     * turned last, in the order they were added, one frame behind.
+     * @return Number of looped links
+     */
+    int GetNumLooped() const { return mLooped; }
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_DRIVETRAIN_H
@@ -4,7 +4,6 @@
  */
 
 #include "pch.h"
-#include <sstream>
 #include "Goal.h"
 #include "Machine.h"
 
@@ -64,7 +63,8 @@ const wxPoint2DDouble rScale = wxPoint2DDouble(0.984f, 0.930f);
  * Constructor
  * @param imagesDir The images directory for this goal
  */
-Goal::Goal(const std::wstring &imagesDir) : Component()
+Goal::Goal(const std::wstring &imagesDir) : Component(),
+    mScoreLabels(ScoreboardFontSize, *wxWHITE)
 {
     mGoalImage.BottomCenteredRectangle(GoalSize);
     mGoalImage.SetImage(imagesDir + GoalImage);
@@ -74,48 +74,41 @@ Goal::Goal(const std::wstring &imagesDir) : Component()
 
     mGoal.BottomCenteredRectangle(TargetSize);
     mGoal.SetColor(*wxGREEN);
+
+    // Increase the score by 2 points when a basket is made
+    mGoal.SetOnEnter([this](b2Body *ball) { mScore += 2; });
 }
 
 
 /**
- * Handle a contact beginning
- *
- * Increase the score by 2 points when a basket is made
- * @param contact Contact object
+ * Draw this goal
+ * @param graphics The graphics context object to draw on
  */
-void Goal::BeginContact(b2Contact *contact)
+void Goal::Draw(RenderContext &graphics)
 {
-    mScore += 2;
+    DrawStatic(graphics);
+    DrawDynamic(graphics);
 }
 
 /**
- * Handle before the solution of a contact with the
- * scoreboard target object. We take this time to
- * turn off the contact, so the ball will pass through.
- * @param contact Contact object
- * @param oldManifold Manifold object
+ * Draw the image of the basketball goal, which never moves
+ * @param graphics The graphics context object to draw on
  */
-void Goal::PreSolve(b2Contact *contact, const b2Manifold *oldManifold)
+void Goal::DrawStatic(RenderContext &graphics)
 {
-    contact->SetEnabled(false);
+    mGoalImage.DrawPolygon(graphics.GetGraphics(),mGoalImagePos.m_x, mGoalImagePos.m_y, GoalRotation);
 }
 
 /**
- * Draw the this goal's polygon as a texture mapped image.
- * @param graphics Graphics object to draw on
+ * Draw the scoreboard
+ * @param graphics The graphics context object to draw on
  */
-void Goal::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Goal::DrawDynamic(RenderContext &graphics)
 {
-    //
-    // Draw the image of the basketball goal
-    //
-    mGoalImage.DrawPolygon(graphics,mGoalImagePos.m_x, mGoalImagePos.m_y, GoalRotation);
-
     //
     // Draw the score text with an inverted scale
     //
-    std::wstringstream score;
-    (mScore < 10) ? score << L"0" << mScore : score << mScore;
+    auto score = (mScore < 10 ? L"0" : L"") + std::to_wstring(mScore);
 
     auto rect = ScoreboardRectangle;
 
@@ -125,27 +118,28 @@ void Goal::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     auto scoreX = mGoalImagePos.m_x + textX;
     auto scoreY = mGoalImagePos.m_y + textY;
 
-    wxPen scorePen(*wxBLACK, ScoreboarderLineWidth);
-    graphics->SetPen(scorePen);
-    graphics->SetBrush(ScoreboardBackgroundColor);
+    graphics.SetPen(*wxBLACK, ScoreboarderLineWidth);
+    graphics.SetBrush(ScoreboardBackgroundColor);
     graphics->DrawRectangle(rScale.m_x * scoreX,
                             rScale.m_y * scoreY,
                             rect.m_width, rect.m_height);
 
-    wxFont font(wxSize(0, ScoreboardFontSize),
-                wxFONTFAMILY_SWISS,
-                wxFONTSTYLE_NORMAL,
-                wxFONTWEIGHT_NORMAL);
-
-    graphics->SetFont(font, *wxWHITE);
-
     graphics->PushState();
     graphics->Translate(scoreX,scoreY);
     graphics->Scale(1, -1);
-    graphics->DrawText(score.str(), 0, 0);
+    mScoreLabels.Draw(graphics.GetGraphics(), score, 0, 0);
     graphics->PopState();
 }
 
+/**
+ * Get the bounds of the goal image
+ * @return Bounds in centimeters
+ */
+wxRect2DDouble Goal::GetStaticBounds()
+{
+    return mGoalImage.BoundingBox(mGoalImagePos.m_x, mGoalImagePos.m_y, GoalRotation);
+}
+
 /**
  * Install this goal into the physics system of its machine
  * @param world The physics system world of this goal's machine
@@ -155,7 +149,7 @@ void Goal::InstallPhysics(std::shared_ptr<b2World> world)
     mPost.InstallPhysics(world);
     mGoal.InstallPhysics(world);
 
-    GetMachine()->GetContactListener()->Add(mGoal.GetBody(), this);
+    GetMachine()->GetContactListener()->AddTrigger(&mGoal, this);
 }
 
 /**
@@ -172,21 +166,38 @@ void Goal::SetPosition(double x, double y)
 
 
 /**
- * Update the time of this goal
- * @param elapsed The new time
+ * Reset this goal if the current machine frame is 0
  */
-void Goal::Update(double elapsed)
+void Goal::Reset()
 {
+    mScore = 0;
+    mGoal.Reset();
 }
 
 /**
- * Reset this goal if the current machine frame is 0
+ * Get the number of physics bodies this component has installed
+ * @return Number of bodies
  */
-void Goal::Reset()
+int Goal::GetBodyCount()
 {
-    mScore = 0;
+    int count = 0;
+    for (auto polygon : std::initializer_list<cse335::PhysicsPolygon *>{&mPost, &mGoal})
+    {
+        if (polygon->GetBody() != nullptr)
+        {
+            count++;
+        }
+    }
+
+    return count;
 }
 
-
-
-
+/**
+ * Get the image files a goal loads
+ * @param imagesDir The images directory
+ * @return Image filenames, named the same way the constructor loads them
+ */
+std::vector<std::wstring> Goal::GetImages(const std::wstring &imagesDir)
+{
+    return {imagesDir + GoalImage};
+}
@@ -12,16 +12,16 @@
 #ifndef CANADIANEXPERIENCE_MACHINELIB_GOAL_H
 #define CANADIANEXPERIENCE_MACHINELIB_GOAL_H
 
-#include <b2_contact.h>
-#include <b2_world_callbacks.h>
 #include "Component.h"
 #include "PhysicsPolygon.h"
+#include "TriggerVolume.h"
+#include "LabelCache.h"
 
 
 /**
  * Class for a basketball goal in a machine
  */
-class Goal : public Component, public b2ContactListener
+class Goal final : public Component
 {
 private:
     /// The current score for this basketball goal
@@ -36,21 +36,34 @@ private:
     /// Physics polygon for the backboard/post
     cse335::PhysicsPolygon mPost;
 
-    /// Polygon that we are going to hit to
-    /// determine the basket has been scored
-    cse335::PhysicsPolygon mGoal;
+    /// Sensor the ball passes through when
+    /// the basket has been scored
+    TriggerVolume mGoal;
+
+    /// Rendered score text
+    LabelCache mScoreLabels;
 
 public:
 
     Goal(const std::wstring &imagesDir);
 
+    static std::vector<std::wstring> GetImages(const std::wstring &imagesDir);
+
     void Reset() override;
-    void Update(double elapsed) override;
-    void BeginContact(b2Contact *contact);
     void SetPosition(double x, double y) override;
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics);
+    void Draw(RenderContext &graphics);
+    void DrawStatic(RenderContext &graphics) override;
+    void DrawDynamic(RenderContext &graphics) override;
+    wxRect2DDouble GetStaticBounds() override;
     void InstallPhysics(std::shared_ptr<b2World> world) override;
-    void PreSolve(b2Contact *contact, const b2Manifold *oldManifold);
+
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Goal"; }
+
+    int GetBodyCount() override;
 
     /// Default constructor (disabled)
     Goal() = delete;
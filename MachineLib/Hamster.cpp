@@ -63,13 +63,13 @@ Hamster::Hamster(const std::wstring & imagesDir)
     //
     // Set this hamster's images
     //
+    std::vector<std::wstring> hamsterImages;
     for (auto hamsterImage : HamsterImages)
     {
-        auto hamster = std::make_shared<cse335::Polygon>();
-        hamster->CenteredSquare(HamsterSize);
-        hamster->SetImage(imagesDir + hamsterImage);
-        mHamsters.push_back(hamster);
+        hamsterImages.push_back(imagesDir + hamsterImage);
     }
+
+    mHamsters = SpriteAtlas::Get(hamsterImages);
 }
 
 /**
@@ -93,27 +93,50 @@ void Hamster::Update(double elapsed)
     SwitchHamsterImage();
 
     //
-    // Hamster is a rotation source : Rotate its rotation sink
+    // Hamster is a rotation source : the machine's drivetrain
+    // passes this on to its sinks
     //
-    if (mSource.GetSink() && mRunning) // reverse the speed for clockwise rotation
-        mSource.GetSink()->Rotate(mRotation, -mSpeed);
+    mSource.Rotate(mRotation, -mSpeed); // reverse the speed for clockwise rotation
 }
 
 /**
  * Draw this hamster
  * @param graphics The graphics context object to draw on
  */
-void Hamster::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Hamster::Draw(RenderContext &graphics)
 {
-    //
-    // Draw the cage first
-    //
-    mCage.Draw(graphics);
+    DrawStatic(graphics);
+    DrawDynamic(graphics);
+}
+
+/**
+ * Draw the cage, which never moves
+ * @param graphics The graphics context object to draw on
+ */
+void Hamster::DrawStatic(RenderContext &graphics)
+{
+    mCage.Draw(graphics.GetGraphics());
+}
+
+/**
+ * Get the bounds of the cage
+ * @return Bounds in centimeters
+ */
+wxRect2DDouble Hamster::GetStaticBounds()
+{
+    return mCage.PlacedBoundingBox();
+}
 
+/**
+ * Draw the wheel and the hamster running in it
+ * @param graphics The graphics context object to draw on
+ */
+void Hamster::DrawDynamic(RenderContext &graphics)
+{
     //
-    // Draw the wheel next
+    // Draw the wheel first
     //
-    mWheel.DrawPolygon(graphics, mWheelPosition.m_x, mWheelPosition.m_y, mRotation);
+    mWheel.DrawPolygon(graphics.GetGraphics(), mWheelPosition.m_x, mWheelPosition.m_y, mRotation);
 
     //
     // Draw the hamster
@@ -123,10 +146,13 @@ void Hamster::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     graphics->PushState();
     graphics->Translate(mWheelPosition.m_x, mWheelPosition.m_y);
 
+    // The Y axis is inverted, so flip the image to draw it upright
     if(mSpeed < 0 && mHamsterIndex)
-        graphics->Scale(-1, 1);
+        graphics->Scale(-1, -1);
+    else
+        graphics->Scale(1, -1);
 
-    mHamsters[mHamsterIndex]->DrawPolygon(graphics, 0, 0, 0);
+    mHamsters->DrawFrame(graphics.GetGraphics(), mHamsterIndex, -HamsterSize / 2, -HamsterSize / 2, HamsterSize, HamsterSize);
 
     graphics->PopState();
 }
@@ -147,7 +173,7 @@ void Hamster::BeginContact(b2Contact *contact)
 void Hamster::InstallPhysics(std::shared_ptr<b2World> world)
 {
     mCage.InstallPhysics(world);
-    GetMachine()->GetContactListener()->Add(mCage.GetBody(), this);
+    GetMachine()->GetContactListener()->Add(mCage.GetBody(), this, this);
 }
 
 /**
@@ -281,6 +307,7 @@ void Hamster::Reset()
         mRunning = false;
         mHamsterIndex = 0;
         mCycleMode = Mode::Advance;
+        mSource.Reset();
     }
 }
 
@@ -315,5 +342,27 @@ void Hamster::SwitchHamsterImage()
     }
 }
 
+/**
+ * Get the number of physics bodies this component has installed
+ * @return Number of bodies
+ */
+int Hamster::GetBodyCount()
+{
+    return mCage.GetBody() != nullptr ? 1 : 0;
+}
 
+/**
+ * Get the image files a hamster loads
+ * @param imagesDir The images directory
+ * @return Image filenames, named the same way the constructor loads them
+ */
+std::vector<std::wstring> Hamster::GetImages(const std::wstring &imagesDir)
+{
+    std::vector<std::wstring> images = {imagesDir + HamsterCageImage, imagesDir + HamsterWheelImage};
+    for (auto hamsterImage : HamsterImages)
+    {
+        images.push_back(imagesDir + hamsterImage);
+    }
 
+    return images;
+}
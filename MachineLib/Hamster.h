@@ -14,11 +14,12 @@
 #include "Polygon.h"
 #include "PhysicsPolygon.h"
 #include "RotationSource.h"
+#include "SpriteAtlas.h"
 
 /**
  * Class for a hamster in a machine
  */
-class Hamster : public Component, public b2ContactListener
+class Hamster final : public Component, public b2ContactListener
 {
 private:
 
@@ -46,24 +47,29 @@ private:
     /// The cycle mode for this hamster (default is forward)
     Mode mCycleMode = Mode::Advance;
 
-    /// Images of orientations for this hamster
-    std::vector<std::shared_ptr<cse335::Polygon>> mHamsters;
+    /// Images of orientations for this hamster, shared by all hamsters
+    std::shared_ptr<SpriteAtlas> mHamsters;
 
 public:
 
     Hamster(const std::wstring &imagesDir);
 
+    static std::vector<std::wstring> GetImages(const std::wstring &imagesDir);
+
     void Reset() override;
     void SwitchHamsterImage();
-    void Update(double elapsed) override;
+    void Update(double elapsed);
     void BeginContact(b2Contact *contact);
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
+    void DrawStatic(RenderContext &graphics) override;
+    void DrawDynamic(RenderContext &graphics) override;
+    wxRect2DDouble GetStaticBounds() override;
     void InstallPhysics(std::shared_ptr<b2World> world) override;
 
     bool IsRunning() const;
     double GetSpeed() const;
     double GetRotation() const;
-    RotationSource *GetSource();
+    RotationSource *GetSource() override;
     bool IsInitiallyRunning() const;
     wxPoint2DDouble GetShaftPosition() const;
 
@@ -74,6 +80,14 @@ public:
     void SetPosition(double x, double y) override;
     void SetPosition(wxPoint2DDouble position) override;
 
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Hamster"; }
+
+    int GetBodyCount() override;
+
     /// Default constructor (disabled)
     Hamster() = delete;
 
@@ -11,6 +11,12 @@
 #include "Pulley.h"
 #include "Machine.h"
 
+/// Image for the pulleys between the hamster and the conveyor
+const std::wstring PulleyImage = L"/pulley3.png";
+
+/// Image for the ball placed on the conveyor
+const std::wstring BallImage = L"/ball1.png";
+
 /**
  * Create a hamster that is a conveyor.
  * @param hamsterPosition Where to place the hamster
@@ -32,14 +38,14 @@ void HamsterAndConveyorFactory::Create(wxPoint2DDouble hamsterPosition, wxPoint2
 
     // The pulley driven by the hamster
     auto pulley1 = std::make_shared<Pulley>(10, mRock);
-    pulley1->SetImage(mImagesDir + L"/pulley3.png");
+    pulley1->SetImage(mImagesDir + PulleyImage);
     pulley1->SetPosition(hamsterShaft);
     mMachine->AddComponent(pulley1);
 
     hamster->GetSource()->AddSink(pulley1);
 
     auto pulley2 = std::make_shared<Pulley>(mPulley2Raduis, mRock);
-    pulley2->SetImage(mImagesDir + L"/pulley3.png");
+    pulley2->SetImage(mImagesDir + PulleyImage);
     pulley2->SetPosition(conveyorShaft);
     mMachine->AddComponent(pulley2);
 
@@ -59,7 +65,7 @@ std::shared_ptr<Body> HamsterAndConveyorFactory::AddBall(double placement)
     // Ball
     auto ball = std::make_shared<Body>();
     ball->Circle(12);
-    ball->SetImage(mImagesDir + L"/ball1.png");
+    ball->SetImage(mImagesDir + BallImage);
     ball->SetInitialPosition(mConveyor->GetPosition() + wxPoint2DDouble(placement, 26));
     ball->SetDynamic();
     ball->SetPhysics(2, 0.5, 0.1);
@@ -67,3 +73,25 @@ std::shared_ptr<Body> HamsterAndConveyorFactory::AddBall(double placement)
 
     return ball;
 }
+
+/**
+ * Get the image files the components this factory creates load
+ * @param imagesDir Directory containing the images
+ * @return Image filenames
+ */
+std::vector<std::wstring> HamsterAndConveyorFactory::GetImages(const std::wstring &imagesDir)
+{
+    std::vector<std::wstring> images = {imagesDir + PulleyImage, imagesDir + BallImage};
+
+    for (auto &image : Hamster::GetImages(imagesDir))
+    {
+        images.push_back(image);
+    }
+
+    for (auto &image : Conveyor::GetImages(imagesDir))
+    {
+        images.push_back(image);
+    }
+
+    return images;
+}
@@ -81,6 +81,8 @@ public:
 
     std::shared_ptr<Body> AddBall(double placement);
 
+    static std::vector<std::wstring> GetImages(const std::wstring &imagesDir);
+
     /**
      * Get the constructed Hamster object
      * @return Hamster object
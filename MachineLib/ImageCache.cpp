@@ -0,0 +1,123 @@
+/**
+ * @file ImageCache.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include "ImageCache.h"
+
+std::map<std::wstring, std::shared_ptr<wxImage>> ImageCache::mImages;
+std::mutex ImageCache::mMutex;
+
+/**
+ * Decode an image file
+ * @param filename File to decode
+ * @return Decoded image or nullptr if the file could not be loaded
+ */
+std::shared_ptr<wxImage> ImageCache::Decode(const std::wstring &filename)
+{
+    // Prevent error popup from wxWidgets
+    wxLogNull logNo;
+
+    auto image = std::make_shared<wxImage>();
+    if (!image->LoadFile(filename, wxBITMAP_TYPE_ANY))
+    {
+        return nullptr;
+    }
+
+    return image;
+}
+
+/**
+ * Decode a list of image files in parallel and add them to the cache.
+ *
+ * Files that are already in the cache are skipped. Returns
+ * when every file has been decoded.
+ * @param filenames Files to decode
+ */
+void ImageCache::Preload(const std::vector<std::wstring> &filenames)
+{
+    std::vector<std::wstring> pending;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto &filename : filenames)
+        {
+            if (mImages.find(filename) == mImages.end() &&
+                std::find(pending.begin(), pending.end(), filename) == pending.end())
+            {
+                pending.push_back(filename);
+            }
+        }
+    }
+
+    if (pending.empty())
+    {
+        return;
+    }
+
+    // Each worker takes the next file until none are left
+    std::atomic<size_t> next(0);
+    auto worker = [&pending, &next]() {
+        for (size_t i = next++; i < pending.size(); i = next++)
+        {
+            auto image = Decode(pending[i]);
+
+            std::lock_guard<std::mutex> lock(mMutex);
+            mImages.emplace(pending[i], image);
+        }
+    };
+
+    size_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+    threadCount = std::min(threadCount, pending.size());
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threadCount; i++)
+    {
+        threads.emplace_back(worker);
+    }
+
+    // The calling thread works too rather than just waiting
+    worker();
+
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * Get a decoded image, decoding it now if it is not in the cache
+ * @param filename Image file
+ * @return Decoded image or nullptr if the file could not be loaded
+ */
+std::shared_ptr<wxImage> ImageCache::Get(const std::wstring &filename)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto found = mImages.find(filename);
+        if (found != mImages.end())
+        {
+            return found->second;
+        }
+    }
+
+    auto image = Decode(filename);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mImages.emplace(filename, image).first->second;
+}
+
+/**
+ * Remove all images from the cache.
+ *
+ * Images that are still in use stay valid until their
+ * users release them.
+ */
+void ImageCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mImages.clear();
+}
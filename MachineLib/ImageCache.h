@@ -0,0 +1,47 @@
+/**
+ * @file ImageCache.h
+ * @author Mate Narh
+ *
+ * Process wide cache of decoded images.
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_IMAGECACHE_H
+#define CANADIANEXPERIENCE_MACHINELIB_IMAGECACHE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Process wide cache of decoded images.
+ *
+ * Decoding the images is most of the startup time, so the
+ * files we know we will need can be decoded up front in
+ * parallel with Preload. Get then returns the decoded image
+ * and only decodes on the calling thread if the file was not
+ * preloaded. Images in the cache are shared, so users must
+ * copy an image before changing it.
+ */
+class ImageCache {
+private:
+    /// Decoded images by filename. An entry with a null
+    /// image is a file that could not be loaded.
+    static std::map<std::wstring, std::shared_ptr<wxImage>> mImages;
+
+    /// Protects mImages
+    static std::mutex mMutex;
+
+    static std::shared_ptr<wxImage> Decode(const std::wstring &filename);
+
+public:
+    /// Constructor (disabled)
+    ImageCache() = delete;
+
+    static void Preload(const std::vector<std::wstring> &filenames);
+    static std::shared_ptr<wxImage> Get(const std::wstring &filename);
+    static void Clear();
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_IMAGECACHE_H
@@ -0,0 +1,84 @@
+/**
+ * @file LabelCache.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "LabelCache.h"
+
+/// Most labels we keep before starting over. Each new
+/// zoom level adds a set of labels at a new size.
+const size_t MaxLabels = 256;
+
+/**
+ * Constructor
+ * @param fontSize Font height in the units of the context labels are drawn on
+ * @param color Text color
+ */
+LabelCache::LabelCache(double fontSize, const wxColour &color) : mFontSize(fontSize), mColor(color)
+{
+}
+
+/**
+ * Draw a label, rendering it first if it is not in the cache
+ * @param graphics Graphics context to draw on
+ * @param text Text to draw
+ * @param x X position of the label
+ * @param y Top of the label
+ * @param align Fraction of the label width that is left of x
+ */
+void LabelCache::Draw(const std::shared_ptr<wxGraphicsContext> &graphics, const std::wstring &text,
+        double x, double y, double align)
+{
+    // Render at the font size the label has on the device,
+    // including any HiDPI content scale
+    double a, b, c, d;
+    graphics->GetTransform().Get(&a, &b, &c, &d);
+    double contentScale = graphics->GetContentScaleFactor();
+    int pixelSize = std::max(1, (int)(mFontSize * sqrt(fabs(a * d - b * c)) * contentScale + 0.5));
+
+    auto key = std::make_tuple(pixelSize, contentScale, text);
+    auto found = mLabels.find(key);
+    if (found == mLabels.end())
+    {
+        if (mLabels.size() >= MaxLabels)
+        {
+            mLabels.clear();
+        }
+
+        wxFont font(wxSize(0, pixelSize),
+                wxFONTFAMILY_SWISS,
+                wxFONTSTYLE_NORMAL,
+                wxFONTWEIGHT_NORMAL);
+
+        double w, h;
+        std::unique_ptr<wxGraphicsContext> measure(wxGraphicsContext::Create());
+        measure->SetFont(font, mColor);
+        measure->GetTextExtent(text, &w, &h);
+
+        Label label;
+        label.mWidth = std::max(1, (int)ceil(w));
+        label.mHeight = std::max(1, (int)ceil(h));
+
+        wxImage image(label.mWidth, label.mHeight);
+        image.InitAlpha();
+        memset(image.GetAlpha(), 0, (size_t)label.mWidth * label.mHeight);
+
+        {
+            // The image is only updated when the context is destroyed
+            std::unique_ptr<wxGraphicsContext> render(wxGraphicsContext::Create(image));
+            render->SetFont(font, mColor);
+            render->DrawText(text, 0, 0);
+        }
+
+        label.mBitmap = graphics->CreateBitmapFromImage(image);
+        found = mLabels.emplace(key, label).first;
+    }
+
+    // Size of a pixel of the label in the current units
+    double unit = mFontSize / pixelSize;
+
+    auto &label = found->second;
+    double wid = label.mWidth * unit;
+    graphics->DrawBitmap(label.mBitmap, x - wid * align, y, wid, label.mHeight * unit);
+}
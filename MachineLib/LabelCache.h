@@ -0,0 +1,83 @@
+/**
+ * @file LabelCache.h
+ * @author Mate Narh
+ *
+ * Cache of text labels rendered into bitmaps
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_LABELCACHE_H
+#define CANADIANEXPERIENCE_MACHINELIB_LABELCACHE_H
+
+#include <map>
+#include <string>
+#include <tuple>
+
+/**
+ * Cache of text labels rendered into bitmaps.
+ *
+ * Each label is rendered once in a fixed font and color at
+ * the size it appears on the device, and drawn as a bitmap
+ * after that. Drawing a cached label needs no font or
+ * text measurement.
+ */
+class LabelCache
+{
+private:
+    /// A rendered label
+    struct Label
+    {
+        wxGraphicsBitmap mBitmap; ///< The rendered text
+        int mWidth = 0;           ///< Bitmap width in pixels
+        int mHeight = 0;          ///< Bitmap height in pixels
+    };
+
+    /// Font height in the units of the context labels are drawn on
+    double mFontSize;
+
+    /// Text color
+    wxColour mColor;
+
+    /// Rendered labels by font height in pixels, content scale and text
+    std::map<std::tuple<int, double, std::wstring>, Label> mLabels;
+
+    void Draw(const std::shared_ptr<wxGraphicsContext> &graphics, const std::wstring &text,
+            double x, double y, double align);
+
+public:
+    LabelCache(double fontSize, const wxColour &color);
+
+    /// Default constructor (disabled)
+    LabelCache() = delete;
+
+    /// Copy constructor (disabled)
+    LabelCache(const LabelCache &) = delete;
+
+    /// Assignment operator
+    void operator=(const LabelCache &) = delete;
+
+    /**
+     * Draw a label with its top left corner at x, y
+     * @param graphics Graphics context to draw on
+     * @param text Text to draw
+     * @param x Left of the label
+     * @param y Top of the label
+     */
+    void Draw(const std::shared_ptr<wxGraphicsContext> &graphics, const std::wstring &text, double x, double y)
+    {
+        Draw(graphics, text, x, y, 0);
+    }
+
+    /**
+     * Draw a label centered horizontally on x with its top at y
+     * @param graphics Graphics context to draw on
+     * @param text Text to draw
+     * @param x Center of the label
+     * @param y Top of the label
+     */
+    void DrawCentered(const std::shared_ptr<wxGraphicsContext> &graphics, const std::wstring &text, double x, double y)
+    {
+        Draw(graphics, text, x, y, 0.5);
+    }
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_LABELCACHE_H
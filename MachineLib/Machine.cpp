@@ -10,6 +10,12 @@
 #include "Component.h"
 #include "MachineSystem.h"
 #include "DebugDraw.h"
+#include "StaticLayer.h"
+#include "Hamster.h"
+#include "Conveyor.h"
+#include "Basket.h"
+#include "Tracer.h"
+#include "Metrics.h"
 
 /// Gravity in meters per second per second
 const float Gravity = -9.8f;
@@ -35,19 +41,165 @@ Machine::Machine(int number) : mNumber(number)
  */
 void Machine::AddComponent(std::shared_ptr<Component> component)
 {
+    ComponentStats stats;
+    stats.mType = component->GetTypeName();
+    for (auto &other : mComponentStats)
+    {
+        if (other.mType == stats.mType)
+        {
+            stats.mInstance++;
+        }
+    }
+
     mComponents.push_back(component);
+    mComponentStats.push_back(stats);
     component->SetMachine(this);
+    mDrawPlanValid = false;
+    mUpdatePoolsValid = false;
 }
 
 /**
  * Draw this component
  * @param graphics The graphics context object to draw on
  */
-void Machine::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Machine::Draw(RenderContext &graphics)
 {
-    for (auto component : mComponents)
+    if (!mDrawPlanValid)
+    {
+        for (size_t i = 0; i < mComponents.size(); i++)
+        {
+            double start = MetricTimer::Now();
+            mComponents[i]->Draw(graphics);
+            mComponentStats[i].RecordDraw(MetricTimer::Now() - start);
+        }
+
+        return;
+    }
+
+    for (auto &step : mDrawPlan)
+    {
+        double start = MetricTimer::Now();
+        if (step.mLayer != nullptr)
+        {
+            step.mLayer->Draw(graphics);
+        }
+        else
+        {
+            step.mComponent->DrawDynamic(graphics);
+        }
+
+        step.mStats->RecordDraw(MetricTimer::Now() - start);
+    }
+}
+
+/**
+ * Split the components into cached static layers and moving parts.
+ *
+ * The static parts of consecutive components share a layer until
+ * a component with moving parts is reached, so everything is still
+ * drawn in the order the components were added. Must be called
+ * after the components are installed in the physics system, since
+ * that is where static bodies get their positions.
+ */
+void Machine::BuildDrawPlan()
+{
+    mDrawPlan.clear();
+    mLayerStats.clear();
+
+    std::shared_ptr<StaticLayer> layer;
+    for (size_t i = 0; i < mComponents.size(); i++)
+    {
+        auto component = mComponents[i].get();
+        if (!component->GetStaticBounds().IsEmpty())
+        {
+            if (layer == nullptr)
+            {
+                layer = std::make_shared<StaticLayer>();
+                mDrawPlan.push_back({layer, nullptr, nullptr});
+
+                ComponentStats stats;
+                stats.mType = L"StaticLayer";
+                stats.mInstance = (int)mLayerStats.size();
+                mLayerStats.push_back(stats);
+            }
+
+            layer->Add(component);
+        }
+
+        if (!component->IsStatic())
+        {
+            mDrawPlan.push_back({nullptr, component, &mComponentStats[i]});
+            layer = nullptr;
+        }
+    }
+
+    // The layer stats are complete, so pointers into them stay valid
+    int layerNum = 0;
+    for (auto &step : mDrawPlan)
+    {
+        if (step.mLayer != nullptr)
+        {
+            step.mStats = &mLayerStats[layerNum++];
+        }
+    }
+
+    mDrawPlanValid = true;
+}
+
+/**
+ * Sort the components that have per-frame work into a pool
+ * for each type. Pulleys are turned by the drivetrain, and
+ * bodies, goals and curtains only move by physics, so they
+ * have no Update and are left out of the update pass. A new
+ * component type with an Update needs a pool here.
+ */
+void Machine::BuildUpdatePools()
+{
+    mHamsters = UpdatePool<Hamster>();
+    mConveyors = UpdatePool<Conveyor>();
+    mBaskets = UpdatePool<Basket>();
+
+    for (size_t i = 0; i < mComponents.size(); i++)
+    {
+        AddToPool(mHamsters, i);
+        AddToPool(mConveyors, i);
+        AddToPool(mBaskets, i);
+    }
+
+    mUpdatePoolsValid = true;
+}
+
+/**
+ * Add a component to a pool if it is of the pool's type
+ * @tparam T Component type the pool holds
+ * @param pool Pool to add to
+ * @param index Index of the component in mComponents
+ */
+template <class T>
+void Machine::AddToPool(UpdatePool<T> &pool, size_t index)
+{
+    auto component = dynamic_cast<T *>(mComponents[index].get());
+    if (component != nullptr)
+    {
+        pool.mComponents.push_back(component);
+        pool.mStats.push_back(&mComponentStats[index]);
+    }
+}
+
+/**
+ * Update every component in a pool
+ * @tparam T Component type the pool holds
+ * @param pool Pool to update
+ * @param elapsed The time elapsed in seconds
+ */
+template <class T>
+void Machine::UpdatePoolComponents(UpdatePool<T> &pool, double elapsed)
+{
+    for (size_t i = 0; i < pool.mComponents.size(); i++)
     {
-        component->Draw(graphics);
+        double start = MetricTimer::Now();
+        pool.mComponents[i]->Update(elapsed);
+        pool.mStats[i]->RecordUpdate(MetricTimer::Now() - start);
     }
 }
 
@@ -57,24 +209,46 @@ void Machine::Draw(std::shared_ptr<wxGraphicsContext> graphics)
  */
 void Machine::Update(double elapsed)
 {
+    TRACE_ZONE("Machine::Update");
+
     mCurrentTime += elapsed;
 
-    // Call Update on all of our components so they can advance in time
-    for (auto component : mComponents)
+    if (!mUpdatePoolsValid)
     {
-        component->Update(elapsed);
+        BuildUpdatePools();
     }
 
+    // Update the components that have per-frame work so they can
+    // advance in time. The drivetrain turns everything the hamsters
+    // drive before the conveyors move, so the whole chain moves
+    // with this frame's rotation.
+    UpdatePoolComponents(mHamsters, elapsed);
+    mDrivetrain.Rotate();
+    UpdatePoolComponents(mConveyors, elapsed);
+    UpdatePoolComponents(mBaskets, elapsed);
+
     // Advance the physics system one frame in time
-    mWorld->Step(elapsed, VelocityIterations, PositionIterations);
+    {
+        TRACE_ZONE("b2World::Step");
+        mWorld->Step(elapsed, VelocityIterations, PositionIterations);
+    }
+
+    // Report what entered and left the trigger volumes during the step
+    if (mContactListener != nullptr)
+    {
+        mContactListener->DrainTriggers();
+    }
 }
 
 /**
  * Resets the physics world of this machine by
  *
  * 1. Creating a new b2World object
- * 2. Creating a new ContactListener object and
- * 3. Installing each component into the physics system
+ * 2. Creating a new ContactListener object
+ * 3. Installing each component into the physics system and
+ * 4. Building the plan for drawing the machine and
+ * 5. Sorting the components into update pools and
+ * 6. Ordering the drivetrain
  */
 void Machine::Reset()
 {
@@ -84,8 +258,14 @@ void Machine::Reset()
     mWorld = std::make_shared<b2World>(b2Vec2(0.0f, Gravity));
 
     //
-    // 2 Create and install a new contact filter object
+    // 2 Create and install a new contact filter object. The old
+    // one's contact counts are kept in the component stats.
     //
+    for (size_t i = 0; i < mComponents.size() && mContactListener != nullptr; i++)
+    {
+        mComponentStats[i].mContacts += mContactListener->GetContactCount(mComponents[i].get());
+    }
+
     mContactListener = std::make_shared<ContactListener>();
     mWorld->SetContactListener(mContactListener.get());
 
@@ -98,6 +278,77 @@ void Machine::Reset()
         component->Reset();
         component->InstallPhysics(mWorld);
     }
+
+    //
+    // 4 Sort the components into static and moving parts the
+    // first time. Static parts do not change on a reset, so the
+    // cached layers are kept after that.
+    //
+    if (!mDrawPlanValid)
+    {
+        BuildDrawPlan();
+    }
+
+    //
+    // 5 Sort the components that do per-frame work by type
+    //
+    if (!mUpdatePoolsValid)
+    {
+        BuildUpdatePools();
+    }
+
+    //
+    // 6 Order the rotation sources so each is turned before
+    // the sinks it drives
+    //
+    mDrivetrain.Build(mComponents);
+}
+
+/**
+ * Get the timing and counters for each component, followed
+ * by the drawing times of the cached static layers
+ * @return Stats for each component and layer
+ */
+std::vector<ComponentStats> Machine::GetComponentStats()
+{
+    std::vector<ComponentStats> stats;
+    for (size_t i = 0; i < mComponents.size(); i++)
+    {
+        auto component = mComponents[i].get();
+        stats.push_back(mComponentStats[i]);
+        stats.back().mBodies = component->GetBodyCount();
+
+        // Add the contacts since the last reset
+        if (mContactListener != nullptr)
+        {
+            stats.back().mContacts += mContactListener->GetContactCount(component);
+        }
+    }
+
+    stats.insert(stats.end(), mLayerStats.begin(), mLayerStats.end());
+    return stats;
+}
+
+/**
+ * Clear the timing and counters for the components
+ */
+void Machine::ClearComponentStats()
+{
+    for (auto stats : {&mComponentStats, &mLayerStats})
+    {
+        for (auto &entry : *stats)
+        {
+            ComponentStats cleared;
+            cleared.mType = entry.mType;
+            cleared.mInstance = entry.mInstance;
+            entry = cleared;
+        }
+    }
+
+    if (mContactListener != nullptr)
+    {
+        mContactListener->ClearContactCounts();
+    }
 }
 
 /**
@@ -10,10 +10,17 @@
 
 #include "PhysicsPolygon.h"
 #include "ContactListener.h"
+#include "ComponentStats.h"
+#include "Drivetrain.h"
 
 /// Forward references
 class Component;
 class MachineSystem;
+class StaticLayer;
+class Hamster;
+class Conveyor;
+class Basket;
+class RenderContext;
 
 /**
  * Base class for a machine
@@ -34,6 +41,54 @@ private:
     std::shared_ptr<ContactListener> mContactListener;   ///< This machine's installed contact filter
     std::vector<std::shared_ptr<Component>> mComponents; ///< Collection this machine's components
 
+    /**
+     * One step in drawing the machine: a cached layer of
+     * static parts or the moving parts of one component
+     */
+    struct DrawStep
+    {
+        std::shared_ptr<StaticLayer> mLayer; ///< Static layer to draw, if any
+        Component *mComponent = nullptr;     ///< Component to draw the moving parts of, if any
+        ComponentStats *mStats = nullptr;    ///< Where to record the drawing time
+    };
+
+    std::vector<DrawStep> mDrawPlan; ///< How to draw the machine, built after Reset
+    bool mDrawPlanValid = false;     ///< Is mDrawPlan up to date with mComponents?
+
+    std::vector<ComponentStats> mComponentStats; ///< Stats for each component in mComponents
+    std::vector<ComponentStats> mLayerStats;     ///< Stats for each static layer in mDrawPlan
+
+    /**
+     * The components of one type that do work every frame.
+     *
+     * The pools hold raw pointers to the components, which are
+     * owned by mComponents and are not moved into contiguous
+     * storage. Update is not virtual, so a component type only
+     * does per-frame work if it has a pool here.
+     */
+    template <class T>
+    struct UpdatePool
+    {
+        std::vector<T *> mComponents;         ///< Components of this type in the order added
+        std::vector<ComponentStats *> mStats; ///< Where to record the update time of each
+    };
+
+    UpdatePool<Hamster> mHamsters;   ///< Hamsters, which drive everything else
+    UpdatePool<Conveyor> mConveyors; ///< Conveyors, which move what is on them
+    UpdatePool<Basket> mBaskets;     ///< Baskets, which throw what lands in them
+
+    bool mUpdatePoolsValid = false;  ///< Are the update pools up to date with mComponents?
+
+    Drivetrain mDrivetrain;          ///< Carries the hamster rotation to pulleys, conveyors and bodies
+
+    void BuildDrawPlan();
+    void BuildUpdatePools();
+
+    template <class T>
+    void AddToPool(UpdatePool<T> &pool, size_t index);
+
+    template <class T>
+    void UpdatePoolComponents(UpdatePool<T> &pool, double elapsed);
 
 public:
 
@@ -41,7 +96,7 @@ public:
 
     void Reset();
     void Update(double elapsed);
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics);
+    void Draw(RenderContext &graphics);
     void AddComponent(std::shared_ptr<Component> component);
 
     void SetNumber(int number);
@@ -59,6 +114,9 @@ public:
     std::shared_ptr<b2World> GetWorld() const;
     std::shared_ptr<ContactListener> GetContactListener() const;
 
+    std::vector<ComponentStats> GetComponentStats();
+    void ClearComponentStats();
+
 
     /// Default constructor (disabled)
     Machine() = delete;
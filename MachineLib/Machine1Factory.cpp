@@ -17,6 +17,36 @@
 /// The images directory in resources
 const std::wstring ImagesDirectory = L"/images";
 
+/// Image for the floor
+const std::wstring FloorImage = L"/floor.png";
+
+/// Image for the beams
+const std::wstring BeamImage = L"/beam.png";
+
+/// Image for the wedge
+const std::wstring WedgeImage = L"/wedge.png";
+
+/// Image for the first basketball
+const std::wstring Basketball1Image = L"/basketball1.png";
+
+/// Image for the second basketball
+const std::wstring Basketball2Image = L"/basketball2.png";
+
+/// Image for the spinning arm
+const std::wstring ArmImage = L"/arm.png";
+
+/// Image for a black domino
+const std::wstring DominoBlackImage = L"/domino-black.png";
+
+/// Image for a red domino
+const std::wstring DominoRedImage = L"/domino-red.png";
+
+/// Image for a green domino
+const std::wstring DominoGreenImage = L"/domino-green.png";
+
+/// Image for a blue domino
+const std::wstring DominoBlueImage = L"/domino-blue.png";
+
 
 /**
  * Constructor
@@ -56,7 +86,7 @@ std::shared_ptr<Machine> Machine1Factory::Create()
     //
     auto floor = std::make_shared<Body>();
     floor->Rectangle(-FloorWidth/2, -FloorHeight, FloorWidth, FloorHeight);
-    floor->SetImage(mImagesDir + L"/floor.png");
+    floor->SetImage(mImagesDir + FloorImage);
     machine->AddComponent(floor);
 
     //
@@ -148,7 +178,7 @@ void Machine1Factory::TopBeamAndRamp(std::shared_ptr<Machine> machine)
     const double BeamX = -25;
     auto beam1 = std::make_shared<Body>();
     beam1->BottomCenteredRectangle(400, 20);
-    beam1->SetImage(mImagesDir + L"/beam.png");
+    beam1->SetImage(mImagesDir + BeamImage);
     beam1->SetInitialPosition(BeamX, 300);
     machine->AddComponent(beam1);
 
@@ -157,14 +187,14 @@ void Machine1Factory::TopBeamAndRamp(std::shared_ptr<Machine> machine)
     wedge1->AddPoint(25, 0);
     wedge1->AddPoint(25, 4.5);
     wedge1->AddPoint(-25, 25);
-    wedge1->SetImage(mImagesDir + L"/wedge.png");
+    wedge1->SetImage(mImagesDir + WedgeImage);
     wedge1->SetInitialPosition(BeamX-175, 320);
     machine->AddComponent(wedge1);
 
     // Basketball 1
     auto basketball1 = std::make_shared<Body>();
     basketball1->Circle(12);
-    basketball1->SetImage(mImagesDir + L"/basketball1.png");
+    basketball1->SetImage(mImagesDir + Basketball1Image);
     basketball1->SetInitialPosition(BeamX-186, 353);
     basketball1->SetDynamic();
     basketball1->SetPhysics(1, 0.5, 0.6);
@@ -202,14 +232,14 @@ void Machine1Factory::BeamAndSpinningArm(std::shared_ptr<Machine> machine)
     const double Beam2X = -25;
     auto beam2 = std::make_shared<Body>();
     beam2->BottomCenteredRectangle(400, 20);
-    beam2->SetImage(mImagesDir + L"/beam.png");
+    beam2->SetImage(mImagesDir + BeamImage);
     beam2->SetInitialPosition(Beam2X, 240);
     machine->AddComponent(beam2);
 
     // Basketball 2
     auto basketball2 = std::make_shared<Body>();
     basketball2->Circle(12);
-    basketball2->SetImage(mImagesDir + L"/basketball2.png");
+    basketball2->SetImage(mImagesDir + Basketball2Image);
     basketball2->SetInitialPosition(Beam2X - 170, 240 + 12 + 20);
     basketball2->SetDynamic();
     basketball2->SetPhysics(1, 0.5, 0.75);
@@ -231,7 +261,7 @@ void Machine1Factory::BeamAndSpinningArm(std::shared_ptr<Machine> machine)
     arm->AddPoint(7, 10);
     arm->AddPoint(7, -60);
     arm->AddPoint(-7, -60);
-    arm->SetImage(mImagesDir + L"/arm.png");
+    arm->SetImage(mImagesDir + ArmImage);
     arm->SetKinematic();
     machine->AddComponent(arm);
 
@@ -259,7 +289,7 @@ void Machine1Factory::DominoesOnBeam(std::shared_ptr<Machine> machine, wxPoint2D
     // The beam the dominoes sit on
     auto beam = std::make_shared<Body>();
     beam->BottomCenteredRectangle(150, 15);
-    beam->SetImage(mImagesDir + L"/beam.png");
+    beam->SetImage(mImagesDir + BeamImage);
     beam->SetInitialPosition(position);
     machine->AddComponent(beam);
 
@@ -295,19 +325,19 @@ std::shared_ptr<Body>  Machine1Factory::Domino(std::shared_ptr<Machine> machine,
     switch(color)
     {
         case DominoColor::Black:
-            domino->SetImage(mImagesDir + L"/domino-black.png");
+            domino->SetImage(mImagesDir + DominoBlackImage);
             break;
 
         case DominoColor::Red:
-            domino->SetImage(mImagesDir + L"/domino-red.png");
+            domino->SetImage(mImagesDir + DominoRedImage);
             break;
 
         case DominoColor::Green:
-            domino->SetImage(mImagesDir + L"/domino-green.png");
+            domino->SetImage(mImagesDir + DominoGreenImage);
             break;
 
         case DominoColor::Blue:
-            domino->SetImage(mImagesDir + L"/domino-blue.png");
+            domino->SetImage(mImagesDir + DominoBlueImage);
             break;
     }
 
@@ -318,3 +348,34 @@ std::shared_ptr<Body>  Machine1Factory::Domino(std::shared_ptr<Machine> machine,
 
     return domino;
 }
+
+/**
+ * Get the image files machine #1 loads, so they
+ * can be decoded before the machine is created
+ * @return Image filenames
+ */
+std::vector<std::wstring> Machine1Factory::GetImages()
+{
+    std::vector<std::wstring> images = {mImagesDir + FloorImage,
+            mImagesDir + BeamImage,
+            mImagesDir + WedgeImage,
+            mImagesDir + Basketball1Image,
+            mImagesDir + Basketball2Image,
+            mImagesDir + ArmImage,
+            mImagesDir + DominoBlackImage,
+            mImagesDir + DominoRedImage,
+            mImagesDir + DominoGreenImage,
+            mImagesDir + DominoBlueImage};
+
+    for (auto &image : HamsterAndConveyorFactory::GetImages(mImagesDir))
+    {
+        images.push_back(image);
+    }
+
+    for (auto &image : Goal::GetImages(mImagesDir))
+    {
+        images.push_back(image);
+    }
+
+    return images;
+}
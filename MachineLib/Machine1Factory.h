@@ -10,6 +10,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 class Machine;
 class Body;
@@ -48,6 +49,7 @@ public:
     Machine1Factory(std::wstring resourcesDir);
 
     std::shared_ptr<Machine> Create();
+    std::vector<std::wstring> GetImages();
 
 };
 
@@ -18,6 +18,36 @@
 /// The images directory in resources
 const std::wstring ImagesDirectory = L"/images";
 
+/// Image for the floor
+const std::wstring FloorImage = L"/floor.png";
+
+/// Image for the beams
+const std::wstring BeamImage = L"/beam.png";
+
+/// Image for the wedge
+const std::wstring WedgeImage = L"/wedge.png";
+
+/// Image for the first basketball
+const std::wstring Basketball1Image = L"/basketball1.png";
+
+/// Image for the second basketball
+const std::wstring Basketball2Image = L"/basketball2.png";
+
+/// Image for the spinning arm
+const std::wstring ArmImage = L"/arm.png";
+
+/// Image for a black domino
+const std::wstring DominoBlackImage = L"/domino-black.png";
+
+/// Image for a red domino
+const std::wstring DominoRedImage = L"/domino-red.png";
+
+/// Image for a green domino
+const std::wstring DominoGreenImage = L"/domino-green.png";
+
+/// Image for a blue domino
+const std::wstring DominoBlueImage = L"/domino-blue.png";
+
 //
 // This is a work in progress ....
 //
@@ -60,7 +90,7 @@ std::shared_ptr<Machine> Machine2Factory::Create()
     //
     auto floor = std::make_shared<Body>();
     floor->Rectangle(-FloorWidth/2, -FloorHeight, FloorWidth, FloorHeight);
-    floor->SetImage(mImagesDir + L"/floor.png");
+    floor->SetImage(mImagesDir + FloorImage);
     machine->AddComponent(floor);
 
     //
@@ -135,7 +165,7 @@ void Machine2Factory::TopBeamAndRamp(std::shared_ptr<Machine> machine)
     const double BeamX = -75;
     auto beam1 = std::make_shared<Body>();
     beam1->BottomCenteredRectangle(400, 20);
-    beam1->SetImage(mImagesDir + L"/beam.png");
+    beam1->SetImage(mImagesDir + BeamImage);
     beam1->SetInitialPosition(BeamX, 20);
     machine->AddComponent(beam1);
 
@@ -144,14 +174,14 @@ void Machine2Factory::TopBeamAndRamp(std::shared_ptr<Machine> machine)
     wedge1->AddPoint(25, 0);
     wedge1->AddPoint(25, 4.5);
     wedge1->AddPoint(-25, 25);
-    wedge1->SetImage(mImagesDir + L"/wedge.png");
+    wedge1->SetImage(mImagesDir + WedgeImage);
     wedge1->SetInitialPosition(BeamX-175, 40);
     machine->AddComponent(wedge1);
 
     // Basketball 1
     auto basketball1 = std::make_shared<Body>();
     basketball1->Circle(12);
-    basketball1->SetImage(mImagesDir + L"/basketball1.png");
+    basketball1->SetImage(mImagesDir + Basketball1Image);
     basketball1->SetInitialPosition(BeamX-186, 73);
     basketball1->SetDynamic();
     basketball1->SetPhysics(1, 0.5, 0.6);
@@ -189,14 +219,14 @@ void Machine2Factory::BeamAndSpinningArm(std::shared_ptr<Machine> machine)
     const double Beam2X = -25;
     auto beam2 = std::make_shared<Body>();
     beam2->BottomCenteredRectangle(400, 20);
-    beam2->SetImage(mImagesDir + L"/beam.png");
+    beam2->SetImage(mImagesDir + BeamImage);
     beam2->SetInitialPosition(Beam2X, 240);
     machine->AddComponent(beam2);
 
     // Basketball 2
     auto basketball2 = std::make_shared<Body>();
     basketball2->Circle(12);
-    basketball2->SetImage(mImagesDir + L"/basketball2.png");
+    basketball2->SetImage(mImagesDir + Basketball2Image);
     basketball2->SetInitialPosition(Beam2X - 170, 240 + 12 + 20);
     basketball2->SetDynamic();
     basketball2->SetPhysics(1, 0.5, 0.75);
@@ -218,7 +248,7 @@ void Machine2Factory::BeamAndSpinningArm(std::shared_ptr<Machine> machine)
     arm->AddPoint(7, 10);
     arm->AddPoint(7, -60);
     arm->AddPoint(-7, -60);
-    arm->SetImage(mImagesDir + L"/arm.png");
+    arm->SetImage(mImagesDir + ArmImage);
     arm->SetKinematic();
     machine->AddComponent(arm);
 
@@ -246,7 +276,7 @@ void Machine2Factory::DominoesOnBeam(std::shared_ptr<Machine> machine, wxPoint2D
     // The beam the dominoes sit on
     auto beam = std::make_shared<Body>();
     beam->BottomCenteredRectangle(150, 15);
-    beam->SetImage(mImagesDir + L"/beam.png");
+    beam->SetImage(mImagesDir + BeamImage);
     beam->SetInitialPosition(position);
     machine->AddComponent(beam);
 
@@ -282,19 +312,19 @@ std::shared_ptr<Body>  Machine2Factory::Domino(std::shared_ptr<Machine> machine,
     switch(color)
     {
         case DominoColor::Black:
-            domino->SetImage(mImagesDir + L"/domino-black.png");
+            domino->SetImage(mImagesDir + DominoBlackImage);
             break;
 
         case DominoColor::Red:
-            domino->SetImage(mImagesDir + L"/domino-red.png");
+            domino->SetImage(mImagesDir + DominoRedImage);
             break;
 
         case DominoColor::Green:
-            domino->SetImage(mImagesDir + L"/domino-green.png");
+            domino->SetImage(mImagesDir + DominoGreenImage);
             break;
 
         case DominoColor::Blue:
-            domino->SetImage(mImagesDir + L"/domino-blue.png");
+            domino->SetImage(mImagesDir + DominoBlueImage);
             break;
     }
 
@@ -306,3 +336,43 @@ std::shared_ptr<Body>  Machine2Factory::Domino(std::shared_ptr<Machine> machine,
     return domino;
 }
 
+/**
+ * Get the image files machine #2 loads, so they
+ * can be decoded before the machine is created
+ * @return Image filenames
+ */
+std::vector<std::wstring> Machine2Factory::GetImages()
+{
+    std::vector<std::wstring> images = {mImagesDir + FloorImage,
+            mImagesDir + BeamImage,
+            mImagesDir + WedgeImage,
+            mImagesDir + Basketball1Image,
+            mImagesDir + Basketball2Image,
+            mImagesDir + ArmImage,
+            mImagesDir + DominoBlackImage,
+            mImagesDir + DominoRedImage,
+            mImagesDir + DominoGreenImage,
+            mImagesDir + DominoBlueImage};
+
+    for (auto &image : HamsterAndConveyorFactory::GetImages(mImagesDir))
+    {
+        images.push_back(image);
+    }
+
+    for (auto &image : Goal::GetImages(mImagesDir))
+    {
+        images.push_back(image);
+    }
+
+    for (auto &image : Basket::GetImages(mImagesDir))
+    {
+        images.push_back(image);
+    }
+
+    for (auto &image : Curtain::GetImages(mImagesDir))
+    {
+        images.push_back(image);
+    }
+
+    return images;
+}
@@ -10,6 +10,7 @@ Factory for creating Machine #2
 
 #include <memory>
 #include <string>
+#include <vector>
 
 class Machine;
 class Body;
@@ -48,6 +49,7 @@ public:
     Machine2Factory(std::wstring resourcesDir);
 
     std::shared_ptr<Machine> Create();
+    std::vector<std::wstring> GetImages();
 
 };
 
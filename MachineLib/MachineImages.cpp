@@ -0,0 +1,26 @@
+/**
+ * @file MachineImages.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "MachineImages.h"
+#include "Machine1Factory.h"
+#include "Machine2Factory.h"
+
+/**
+ * Get the image files all of the machines load
+ * @param resourcesDir Directory that contains the resources for this application
+ * @return Image filenames, named the same way the machines load them
+ */
+std::vector<std::wstring> MachineImages::Get(const std::wstring &resourcesDir)
+{
+    auto images = Machine1Factory(resourcesDir).GetImages();
+
+    for (auto &image : Machine2Factory(resourcesDir).GetImages())
+    {
+        images.push_back(image);
+    }
+
+    return images;
+}
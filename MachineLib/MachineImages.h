@@ -0,0 +1,29 @@
+/**
+ * @file MachineImages.h
+ * @author Mate Narh
+ *
+ * The image files the machines load.
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_MACHINEIMAGES_H
+#define CANADIANEXPERIENCE_MACHINELIB_MACHINEIMAGES_H
+
+#include <string>
+#include <vector>
+
+/**
+ * The image files the machines load.
+ *
+ * The application passes these to ImageCache::Preload along
+ * with its own images, so all of them are decoded in one
+ * parallel pass before the machines are built.
+ */
+class MachineImages {
+public:
+    /// Default constructor (disabled)
+    MachineImages() = delete;
+
+    static std::vector<std::wstring> Get(const std::wstring &resourcesDir);
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_MACHINEIMAGES_H
@@ -9,6 +9,18 @@
 #include "Machine1Factory.h"
 #include "Machine2Factory.h"
 #include "DebugDraw.h"
+#include "Tracer.h"
+#include "Metrics.h"
+#include "RenderContext.h"
+#include "SpriteAtlas.h"
+
+/// Height of a line in the component stats table in pixels
+const double StatsLineHeight = 14;
+
+/// Width of the component stats table in pixels
+const double StatsWidth = 520;
+
+int MachineSystem::mLiveSystems = 0;
 
 /**
  * Constructor
@@ -17,6 +29,11 @@
 MachineSystem::MachineSystem(const std::wstring &resourcesDir)
 {
     mResourcesDir = resourcesDir;
+    mLiveSystems++;
+
+    // Each machine system gets its own metrics, until
+    // the application gives it a more useful name
+    SetMetricsName(L"system");
 
     //
     // SetMachineNumber() is more than a setter : it instantiates an
@@ -25,16 +42,38 @@ MachineSystem::MachineSystem(const std::wstring &resourcesDir)
     SetMachineNumber(1);
 }
 
+/**
+ * Destructor
+ *
+ * The last machine system to go releases the shared pen, brush
+ * and atlas pools. The application is still running at that
+ * point, so the graphics renderer they belong to still exists.
+ */
+MachineSystem::~MachineSystem()
+{
+    Metrics::Remove(mMetricsPrefix);
+
+    if (--mLiveSystems == 0)
+    {
+        RenderContext::Clear();
+        SpriteAtlas::Clear();
+    }
+}
+
 /**
  * Draw the machine at the currently specified location
- * @param graphics Graphics object to render to
+ * @param context Graphics object to render to
  */
-void MachineSystem::DrawMachine(std::shared_ptr<wxGraphicsContext> graphics)
+void MachineSystem::DrawMachine(std::shared_ptr<wxGraphicsContext> context)
 {
+    RenderContext graphics(context);
+
     graphics->PushState();
     graphics->Translate(mLocation.x, mLocation.y);
     graphics->Scale(mPixelsPerCentimeter, -mPixelsPerCentimeter);
-    graphics->SetInterpolationQuality(wxINTERPOLATION_BEST);
+    // Polygon picks the mip level closest to the drawn size, so
+    // bilinear filtering is enough to finish the scaling
+    graphics->SetInterpolationQuality(wxINTERPOLATION_GOOD);
 
     if(mFlag & 1)
     {
@@ -58,6 +97,41 @@ void MachineSystem::DrawMachine(std::shared_ptr<wxGraphicsContext> graphics)
 
     graphics->PopState();
 
+    if(mFlag & 4)
+    {
+        DrawStats(graphics);
+    }
+}
+
+/**
+ * Draw a table of the component stats at the machine location
+ * @param graphics Graphics object to render to
+ */
+void MachineSystem::DrawStats(RenderContext &graphics)
+{
+    auto stats = GetComponentStats();
+
+    graphics.SetTransparentPen();
+    graphics.SetBrush(wxColour(255, 255, 255, 200));
+    graphics->DrawRectangle(mLocation.x, mLocation.y, StatsWidth, StatsLineHeight * (stats.size() + 2));
+
+    graphics.SetFont(11, *wxBLACK, wxFONTFAMILY_MODERN);
+
+    double y = mLocation.y;
+    graphics->DrawText(wxString::Format(L"%-16ls %17ls %17ls %8ls %6ls",
+            L"component", L"update ms", L"draw ms", L"contacts", L"bodies"), mLocation.x, y);
+    y += StatsLineHeight;
+
+    for (auto &entry : stats)
+    {
+        auto name = entry.mType + L" " + std::to_wstring(entry.mInstance);
+        graphics->DrawText(wxString::Format(L"%-16ls %8.3f %8.1f %8.3f %8.1f %8ld %6d",
+                name.c_str(), entry.mUpdateLast, entry.mUpdateTotal,
+                entry.mDrawLast, entry.mDrawTotal, entry.mContacts, entry.mBodies), mLocation.x, y);
+        y += StatsLineHeight;
+    }
+
+    graphics->DrawText(wxString::Format(L"%d bodies in the world", GetBodyCount()), mLocation.x, y);
 }
 
 /**
@@ -65,6 +139,16 @@ void MachineSystem::DrawMachine(std::shared_ptr<wxGraphicsContext> graphics)
  * @param frame Frame number
  */
 void MachineSystem::SetMachineFrame(int frame) {
+    TRACE_ZONE("MachineSystem::SetMachineFrame");
+
+    if(frame == mFrame)
+    {
+        mMachine->SetMachineFrame(mFrame);
+        return;
+    }
+
+    double start = MetricTimer::Now();
+    int steps = 0;
 
     if(frame < mFrame)
     {
@@ -73,12 +157,23 @@ void MachineSystem::SetMachineFrame(int frame) {
         mMachine->Reset();
     }
 
-    for( ; mFrame < frame;  mFrame++)
+    for( ; mFrame < frame;  mFrame++, steps++)
     {
         mMachine->SetMachineFrame(mFrame);
         mMachine->Update(1.0 / mFrameRate);
     }
     mMachine->SetMachineFrame(mFrame);
+
+    mSimulateMetric->Record(MetricTimer::Now() - start);
+    mStepsMetric->Record(steps);
+
+    if(steps > 0)
+    {
+        auto &profile = mMachine->GetWorld()->GetProfile();
+        mStepProfile->Record(profile.step);
+        mCollideProfile->Record(profile.collide);
+        mSolveProfile->Record(profile.solve);
+    }
 }
 
 /**
@@ -181,8 +276,58 @@ std::wstring MachineSystem::GetResourcesDir() const
     return mResourcesDir;
 }
 
+/**
+ * Get the timing and counters for each component of the machine.
+ * Update and draw times are last and total in milliseconds.
+ * @return Stats for each component, followed by the cached static layers
+ */
+std::vector<ComponentStats> MachineSystem::GetComponentStats()
+{
+    return mMachine->GetComponentStats();
+}
+
+/**
+ * Clear the timing and counters for the components of the machine
+ */
+void MachineSystem::ClearComponentStats()
+{
+    mMachine->ClearComponentStats();
+}
+
+/**
+ * Get the number of bodies in the machine's physics world
+ * @return Number of bodies
+ */
+int MachineSystem::GetBodyCount() const
+{
+    return mMachine->GetWorld()->GetBodyCount();
+}
+
+/**
+ * Set the name this system's metrics are recorded under, so
+ * they can be told apart from other machines' metrics
+ * @param name Name for the metrics, such as the name of the drawable showing the machine
+ */
+void MachineSystem::SetMetricsName(const std::wstring &name)
+{
+    if (!mMetricsPrefix.empty())
+    {
+        Metrics::Remove(mMetricsPrefix);
+    }
+
+    mMetricsPrefix = Metrics::UniquePrefix(L"machine/" + name);
+    mSimulateMetric = Metrics::Get(mMetricsPrefix + L"simulate");
+    mStepsMetric = Metrics::Get(mMetricsPrefix + L"steps", L"steps");
+    mStepProfile = Metrics::Get(mMetricsPrefix + L"b2 step");
+    mCollideProfile = Metrics::Get(mMetricsPrefix + L"b2 collide");
+    mSolveProfile = Metrics::Get(mMetricsPrefix + L"b2 solve");
+}
+
 /**
  * Set the flag from the control panel
+ *
+ * Bit 1 draws the machine, bit 2 draws the physics
+ * outlines and bit 4 draws the component stats table.
  * @param flag Flag to set
  */
 void MachineSystem::SetFlag(int flag)
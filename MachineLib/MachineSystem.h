@@ -10,6 +10,7 @@
 
 #include "IMachineSystem.h"
 #include "Machine.h"
+#include "Metrics.h"
 
 /**
  * Class for the machine system that controls our machines
@@ -17,6 +18,8 @@
 class MachineSystem : public IMachineSystem
 {
 private:
+    /// Number of machine systems that exist
+    static int mLiveSystems;
 
     int mFlag = 1;     ///< This machine's flag for DebugDraw visualization
     int mFrame = 0;    ///< The frame that this machine is currently on
@@ -32,13 +35,24 @@ private:
 
     std::shared_ptr<Machine> mMachine = nullptr; ///< The machine that this system controls
 
+    std::wstring mMetricsPrefix; ///< Start of the names of this system's metrics
+    Metric *mSimulateMetric;    ///< Time the last seek spent simulating
+    Metric *mStepsMetric;       ///< Number of steps the last seek replayed
+    Metric *mStepProfile;       ///< b2World step time of the last step
+    Metric *mCollideProfile;    ///< b2World collide time of the last step
+    Metric *mSolveProfile;      ///< b2World solve time of the last step
+
+    void DrawStats(RenderContext &graphics);
+
 public:
 
     MachineSystem(const std::wstring &resourcesDir);
+    ~MachineSystem() override;
 
     void DrawMachine(std::shared_ptr<wxGraphicsContext> graphics) override;
 
     void SetFlag(int flag);
+    void SetMetricsName(const std::wstring &name);
     void SetMachineFrame(int frame) override;
     void SetMachineNumber(int machine) override;
     void SetLocation(wxPoint location) override;
@@ -51,6 +65,10 @@ public:
     double GetMachineTime() override;
     std::wstring GetResourcesDir() const;
 
+    std::vector<ComponentStats> GetComponentStats();
+    void ClearComponentStats();
+    int GetBodyCount() const;
+
 };
 
 #endif //CANADIANEXPERIENCE_MACHINELIB_MACHINESYSTEM_H
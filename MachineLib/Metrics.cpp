@@ -0,0 +1,176 @@
+/**
+ * @file Metrics.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <chrono>
+#include "Metrics.h"
+
+std::map<std::wstring, std::unique_ptr<Metric>> Metrics::mMetrics;
+std::mutex Metrics::mMutex;
+
+/**
+ * Constructor
+ * @param name Name of this metric
+ * @param unit Unit the values are in
+ */
+Metric::Metric(const std::wstring &name, const std::wstring &unit) : mName(name), mUnit(unit)
+{
+}
+
+/**
+ * Record a new value
+ * @param value Value to record
+ */
+void Metric::Record(double value)
+{
+    mHistory[mCount % HistorySize] = value;
+    mCount++;
+}
+
+/**
+ * Get the most recent value
+ * @return Value or zero if nothing has been recorded
+ */
+double Metric::GetLast() const
+{
+    return mCount > 0 ? mHistory[(mCount - 1) % HistorySize] : 0;
+}
+
+/**
+ * Get the average of the values in the history
+ * @return Average or zero if nothing has been recorded
+ */
+double Metric::GetAverage() const
+{
+    int num = GetNumSamples();
+    if (num == 0)
+    {
+        return 0;
+    }
+
+    double sum = 0;
+    for (int i = 0; i < num; i++)
+    {
+        sum += mHistory[i];
+    }
+
+    return sum / num;
+}
+
+/**
+ * Get the largest value in the history
+ * @return Largest value or zero if nothing has been recorded
+ */
+double Metric::GetMax() const
+{
+    int num = GetNumSamples();
+    double largest = 0;
+    for (int i = 0; i < num; i++)
+    {
+        largest = std::max(largest, mHistory[i]);
+    }
+
+    return largest;
+}
+
+/**
+ * Get a value from the history
+ * @param i Index from 0, the oldest, to GetNumSamples() - 1, the newest
+ * @return Value
+ */
+double Metric::GetSample(int i) const
+{
+    long first = mCount - GetNumSamples();
+    return mHistory[(first + i) % HistorySize];
+}
+
+/**
+ * Get a metric, creating it the first time it is asked for
+ * @param name Name of the metric
+ * @param unit Unit the values are in, used when the metric is created
+ * @return Metric, valid until it is removed
+ */
+Metric *Metrics::Get(const std::wstring &name, const std::wstring &unit)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto &metric = mMetrics[name];
+    if (metric == nullptr)
+    {
+        metric = std::make_unique<Metric>(name, unit);
+    }
+
+    return metric.get();
+}
+
+/**
+ * Find all metrics with names that start with a prefix
+ * @param prefix Start of the names to find
+ * @return Metrics in name order
+ */
+std::vector<Metric *> Metrics::Find(const std::wstring &prefix)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    std::vector<Metric *> found;
+    for (auto i = mMetrics.lower_bound(prefix);
+            i != mMetrics.end() && i->first.compare(0, prefix.size(), prefix) == 0; ++i)
+    {
+        found.push_back(i->second.get());
+    }
+
+    return found;
+}
+
+/**
+ * Remove all metrics with names that start with a prefix.
+ * Handles to them are no longer valid.
+ * @param prefix Start of the names to remove
+ */
+void Metrics::Remove(const std::wstring &prefix)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto i = mMetrics.lower_bound(prefix);
+    while (i != mMetrics.end() && i->first.compare(0, prefix.size(), prefix) == 0)
+    {
+        i = mMetrics.erase(i);
+    }
+}
+
+/**
+ * Get a prefix for a group of metrics that no existing metric
+ * uses, so the group can later be removed without touching
+ * any other. An owner that shares its path with another gets
+ * a number appended, as in actor/Harold #2/.
+ * @param path Path for the group, such as actor/Harold
+ * @return The path, made unique, followed by /
+ */
+std::wstring Metrics::UniquePrefix(const std::wstring &path)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto prefix = path + L"/";
+    for (int n = 2; ; n++)
+    {
+        auto i = mMetrics.lower_bound(prefix);
+        if (i == mMetrics.end() || i->first.compare(0, prefix.size(), prefix) != 0)
+        {
+            return prefix;
+        }
+
+        prefix = path + L" #" + std::to_wstring(n) + L"/";
+    }
+}
+
+/**
+ * Get the current time for timing
+ * @return Milliseconds on a monotonic clock
+ */
+double MetricTimer::Now()
+{
+    return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
@@ -0,0 +1,134 @@
+/**
+ * @file Metrics.h
+ * @author Mate Narh
+ *
+ * Registry of named performance measurements.
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_METRICS_H
+#define CANADIANEXPERIENCE_MACHINELIB_METRICS_H
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * A named measurement with a short history of recent values.
+ *
+ * Metrics are created by the Metrics registry and live until
+ * they are removed from it, so code that records often can keep
+ * the pointer as a handle and skip the lookup.
+ */
+class Metric {
+public:
+    /// Number of recent values kept
+    static const int HistorySize = 120;
+
+private:
+    /// Name of this metric
+    std::wstring mName;
+
+    /// Unit the values are in, for display
+    std::wstring mUnit;
+
+    /// Recent values, a ring buffer
+    std::array<double, HistorySize> mHistory{};
+
+    /// Number of values ever recorded
+    long mCount = 0;
+
+public:
+    Metric(const std::wstring &name, const std::wstring &unit);
+
+    /// Default constructor (disabled)
+    Metric() = delete;
+
+    /// Copy constructor (disabled)
+    Metric(const Metric &) = delete;
+
+    /// Assignment operator
+    void operator=(const Metric &) = delete;
+
+    void Record(double value);
+    double GetLast() const;
+    double GetAverage() const;
+    double GetMax() const;
+    double GetSample(int i) const;
+
+    /**
+     * Get the name of this metric
+     * @return Name
+     */
+    const std::wstring &GetName() const { return mName; }
+
+    /**
+     * Get the unit the values are in
+     * @return Unit such as ms
+     */
+    const std::wstring &GetUnit() const { return mUnit; }
+
+    /**
+     * Get the number of values in the history
+     * @return Number of values, at most HistorySize
+     */
+    int GetNumSamples() const { return mCount < HistorySize ? (int)mCount : HistorySize; }
+};
+
+/**
+ * Registry of named performance measurements.
+ *
+ * Names are paths like machine/LeftMachine/simulate so related
+ * metrics can be found together with Find.
+ */
+class Metrics {
+private:
+    /// All metrics by name
+    static std::map<std::wstring, std::unique_ptr<Metric>> mMetrics;
+
+    /// Protects mMetrics
+    static std::mutex mMutex;
+
+public:
+    /// Constructor (disabled)
+    Metrics() = delete;
+
+    static Metric *Get(const std::wstring &name, const std::wstring &unit = L"ms");
+    static std::vector<Metric *> Find(const std::wstring &prefix);
+    static void Remove(const std::wstring &prefix);
+    static std::wstring UniquePrefix(const std::wstring &path);
+};
+
+/**
+ * Records the milliseconds from construction to destruction in a metric.
+ */
+class MetricTimer {
+private:
+    /// Metric to record into
+    Metric *mMetric;
+
+    /// Start time in milliseconds
+    double mStart;
+
+public:
+    /**
+     * Constructor
+     * @param metric Metric to record into
+     */
+    explicit MetricTimer(Metric *metric) : mMetric(metric), mStart(Now()) {}
+
+    /// Destructor
+    ~MetricTimer() { mMetric->Record(Now() - mStart); }
+
+    /// Copy constructor (disabled)
+    MetricTimer(const MetricTimer &) = delete;
+
+    /// Assignment operator
+    void operator=(const MetricTimer &) = delete;
+
+    static double Now();
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_METRICS_H
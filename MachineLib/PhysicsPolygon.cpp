@@ -22,7 +22,7 @@ cse335::PhysicsPolygon::PhysicsPolygon() : Polygon()
  * Draw the component
  * @param graphics Graphics device to render to
  */
-void cse335::PhysicsPolygon::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void cse335::PhysicsPolygon::Draw(const std::shared_ptr<wxGraphicsContext> &graphics)
 {
     auto position = GetPosition();
     auto rotation = GetRotation();
@@ -79,6 +79,7 @@ void cse335::PhysicsPolygon::InstallPhysics(std::shared_ptr<b2World> world)
     fixtureDef.density = mDensity;
     fixtureDef.friction = mFriction;
     fixtureDef.restitution = mRestitution;
+    fixtureDef.isSensor = mSensor;
 
     mBody->CreateFixture(&fixtureDef);
 
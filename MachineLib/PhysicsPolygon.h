@@ -11,6 +11,8 @@
  * Version history:
  * 1.00 Initial version for FS23 project 2
  * 1.01 Revised to work prior to physics installation
+ * 1.02 Added IsStatic and PlacedBoundingBox
+ * 1.03 Sensor fixtures, graphics context by const reference
  */
 
 #pragma once
@@ -60,6 +62,9 @@ private:
     /// Restitution (elasticity) in the range [0, 1]
     double mRestitution = 0.5;
 
+    /// Is this a sensor that detects contacts without colliding?
+    bool mSensor = false;
+
 public:
     PhysicsPolygon();
 
@@ -69,7 +74,7 @@ public:
     /// Assignment operator
     void operator=(const PhysicsPolygon &) = delete;
 
-    virtual void Draw(std::shared_ptr<wxGraphicsContext> graphics);
+    virtual void Draw(const std::shared_ptr<wxGraphicsContext> &graphics);
 
     /**
      * Set the component position in the machine
@@ -98,6 +103,31 @@ public:
     void SetKinematic();
     void SetPhysics(double density=1.0, double friction=0.5, double restitution=0.5);
 
+    /**
+     * Make this a sensor. A sensor reports contacts, but
+     * other bodies pass through it and the contact solver
+     * never sees it. Must be called before InstallPhysics.
+     * @param sensor true to make this a sensor
+     */
+    void SetSensor(bool sensor = true) { mSensor = sensor; }
+
+    /**
+     * Is this a static body that never moves?
+     * @return true if static
+     */
+    bool IsStatic() const { return mType == b2_staticBody; }
+
+    /**
+     * Get the bounding box of the polygon where it is
+     * currently drawn
+     * @return Bounding box
+     */
+    wxRect2DDouble PlacedBoundingBox()
+    {
+        auto position = GetPosition();
+        return BoundingBox(position.m_x, position.m_y, GetRotation());
+    }
+
     /**
      * Get the physics body for this component.
      *
@@ -7,9 +7,12 @@
 #include "pch.h"
 
 #include <sstream>
+#include <algorithm>
 #include <wx/hyperlink.h>
 
 #include "Polygon.h"
+#include "ImageCache.h"
+#include "Tracer.h"
 
 using namespace cse335;
 
@@ -199,11 +202,10 @@ void Polygon::SetColor(wxColour color)
  */
 void Polygon::SetImage(std::wstring filename)
 {
-    // Prevent error popup from wxWidgets
-    wxLogNull logNo;
-
-    mImage = std::make_unique<wxImage>();
-    if(mImage->LoadFile(filename, wxBITMAP_TYPE_ANY))
+    mImage = ImageCache::Get(filename);
+    mMaskedImage = wxImage();
+    mLuminanceTable.clear();
+    if(mImage != nullptr)
     {
         mMode = Mode::Image;
     }
@@ -225,7 +227,7 @@ void Polygon::SetImage(std::wstring filename)
  * @param y Y location to draw in pixels
  * @param rotation Rotation in turns (0-1)
  */
-void Polygon::DrawPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double rotation)
+void Polygon::DrawPolygon(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, double rotation)
 {
     if(mPoints.size() < 3)
     {
@@ -238,14 +240,8 @@ void Polygon::DrawPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x,
 
     mHasDrawn = true;
 
-#ifndef WIN32
-    if(mOpacity < 1)
-    {
-        // Layer opacity does not work on Windows systems.
-        graphics->BeginLayer(mOpacity);
-    }
-#endif
-
+    // Opacity is part of the brush color or the cached
+    // bitmap, so no transparency layer is needed
     switch (mMode) {
     case Mode::Color:
         DrawColorPolygon(graphics, x, y, rotation);
@@ -263,13 +259,6 @@ void Polygon::DrawPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x,
                 L"https://facweb.cse.msu.edu/cbowen/cse335/polygon/c/");
         break;
     }
-
-#ifndef WIN32
-    if(mOpacity < 1)
-    {
-        graphics->EndLayer();
-    }
-#endif
 }
 
 
@@ -281,7 +270,7 @@ void Polygon::DrawPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x,
  * @param y Y location to draw in pixels
  * @param rotation Rotation in turns
  */
-void Polygon::DrawColorPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double rotation)
+void Polygon::DrawColorPolygon(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, double rotation)
 {
     if(mPath.IsNull())
     {
@@ -301,116 +290,330 @@ void Polygon::DrawColorPolygon(std::shared_ptr<wxGraphicsContext> graphics, doub
     graphics->Translate(x, y);
     graphics->Rotate(rotation * M_PI * 2);
 
-    graphics->SetBrush(mBrush);
+    if(mOpacity < 1)
+    {
+        auto color = mBrush.GetColour();
+        wxBrush brush(wxColour(color.Red(), color.Green(), color.Blue(),
+                (unsigned char)(color.Alpha() * mOpacity + 0.5)));
+        graphics->SetBrush(brush);
+    }
+    else
+    {
+        graphics->SetBrush(mBrush);
+    }
+
     graphics->FillPath(mPath);
 
     graphics->PopState();
 }
 
+/**
+ * Scale alpha values by an opacity.
+ *
+ * Uses 8 bit fixed point and no branches so the
+ * compiler can vectorize the loop.
+ * @param src Alpha values to scale
+ * @param dst Where to put the scaled values
+ * @param count Number of alpha values
+ * @param opacity Opacity in the range 0 to 1
+ */
+static void ScaleAlpha(const unsigned char *src, unsigned char *dst, size_t count, double opacity)
+{
+    const unsigned scale = (unsigned)(opacity * 256 + 0.5);
+    for(size_t i=0; i<count; i++)
+    {
+        dst[i] = (unsigned char)((src[i] * scale) >> 8);
+    }
+}
+
 /**
  * Draw the polygon as a texture mapped image.
  *
- * This is accomplished by drawing the bitmap image clipped
- * by the supplied polygon points.
+ * The polygon shape is baked into the alpha channel of
+ * the bitmap when the bitmap is created, so the bitmap
+ * is drawn without any clipping.
  *
  * @param graphics Graphics object to draw on
  * @param x X location to draw in pixels
  * @param y Y location to draw in pixels
  * @param rotation Rotation in turn
  */
-void Polygon::DrawImagePolygon(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double rotation)
+void Polygon::DrawImagePolygon(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, double rotation)
 {
-    if(mBitmapDirty || mGraphicsBitmap.IsNull())
-    {
-#ifdef WIN32
-        // Implementation of opacity for Windows systems.
-        // Windows does not support transparency layers.
-        if(mOpacity < 1) {
-            // Ensure the image has an alpha map
-            if (!mImage->HasAlpha()) {
-                mImage->InitAlpha();
-            }
-
-            wxImage img = mImage->Copy();
-
-            unsigned char *alpha = img.GetAlpha();
-            for(int i=0; i<img.GetWidth()*img.GetHeight(); i++)
-            {
-                alpha[i] = int(alpha[i] * mOpacity);
-            }
-
-            mGraphicsBitmap = graphics->CreateBitmapFromImage(img);
-        }
-        else
-        {
-            mGraphicsBitmap = graphics->CreateBitmapFromImage(*mImage);
-        }
-#else
-        mGraphicsBitmap = graphics->CreateBitmapFromImage(*mImage);
-#endif
+    TRACE_ZONE("Polygon::DrawImagePolygon");
 
+    if(!mMaskedImage.IsOk())
+    {
         //
         // Determine the top left and the size of the
         // region covered by our polygon
         //
-        mImageClipRegionTopLeft = mPoints[0];
-        auto imageClipRegionBottomRight = mPoints[0];
+        mImageTopLeft = mPoints[0];
+        auto imageBottomRight = mPoints[0];
 
         for(auto point : mPoints)
         {
-            if(point.m_x < mImageClipRegionTopLeft.m_x) {
-                mImageClipRegionTopLeft.m_x = point.m_x;
+            if(point.m_x < mImageTopLeft.m_x) {
+                mImageTopLeft.m_x = point.m_x;
             }
 
-            if(point.m_y < mImageClipRegionTopLeft.m_y) {
-                mImageClipRegionTopLeft.m_y = point.m_y;
+            if(point.m_y < mImageTopLeft.m_y) {
+                mImageTopLeft.m_y = point.m_y;
             }
 
-            if(point.m_x > imageClipRegionBottomRight.m_x) {
-                imageClipRegionBottomRight.m_x = point.m_x;
+            if(point.m_x > imageBottomRight.m_x) {
+                imageBottomRight.m_x = point.m_x;
             }
 
-            if(point.m_y > imageClipRegionBottomRight.m_y) {
-                imageClipRegionBottomRight.m_y = point.m_y;
+            if(point.m_y > imageBottomRight.m_y) {
+                imageBottomRight.m_y = point.m_y;
             }
         }
 
-        mImageClipRegionSize = imageClipRegionBottomRight - mImageClipRegionTopLeft;
+        mImageSize = imageBottomRight - mImageTopLeft;
 
-        mImageClipRegion.Clear();
-        std::vector<wxPoint> points;
-        for(auto point : mPoints)
-        {
-            points.push_back(wxPoint(int(point.m_x - mImageClipRegionTopLeft.m_x + 0.5),
-                    int(point.m_y - mImageClipRegionTopLeft.m_y + 0.5)));
+        // The image is shared through the cache, so
+        // the mask goes into a copy
+        mMaskedImage = mImage->Copy();
+        if (!mMaskedImage.HasAlpha()) {
+            mMaskedImage.InitAlpha();
         }
 
-        mImageClipRegion = wxRegion(points.size(), &points[0]);
+        MaskImage(mMaskedImage);
+        mMipImages.clear();
+        mMipImages.push_back(mMaskedImage);
+        mBitmapDirty = true;
+    }
+
+    if(mBitmapDirty)
+    {
+        mMipBitmaps.clear();
         mBitmapDirty = false;
     }
 
+    int level = SelectMipLevel(graphics);
+    if(mMipBitmaps.size() <= (size_t)level)
+    {
+        mMipBitmaps.resize(level + 1);
+    }
+
+    auto &bitmap = mMipBitmaps[level];
+    if(bitmap.IsNull())
+    {
+        // Opacity is baked into the alpha of the cached
+        // bitmap, which only changes when the opacity does
+        auto &mip = mMipImages[level];
+        if(mOpacity < 1)
+        {
+            wxImage img = mip.Copy();
+            ScaleAlpha(mip.GetAlpha(), img.GetAlpha(),
+                    (size_t)img.GetWidth() * img.GetHeight(), mOpacity);
+            bitmap = graphics->CreateBitmapFromImage(img);
+        }
+        else
+        {
+            bitmap = graphics->CreateBitmapFromImage(mip);
+        }
+    }
+
     graphics->PushState();
 
     graphics->Translate(x, y);
     graphics->Rotate(rotation * M_PI * 2);
 
-    graphics->Translate(mImageClipRegionTopLeft.m_x, mImageClipRegionTopLeft.m_y);
-    graphics->Clip(mImageClipRegion);
+    graphics->Translate(mImageTopLeft.m_x, mImageTopLeft.m_y);
 
     if(mInvertedY)
     {
         // Flip the bitmap upside down
         graphics->Scale(1, -1);
-        graphics->DrawBitmap(mGraphicsBitmap, 0, -mImageClipRegionSize.m_y, mImageClipRegionSize.m_x, mImageClipRegionSize.m_y);
+        graphics->DrawBitmap(bitmap, 0, -mImageSize.m_y, mImageSize.m_x, mImageSize.m_y);
     }
     else
     {
-        graphics->DrawBitmap(mGraphicsBitmap, 0, 0, mImageClipRegionSize.m_x, mImageClipRegionSize.m_y);
+        graphics->DrawBitmap(bitmap, 0, 0, mImageSize.m_x, mImageSize.m_y);
     }
 
     graphics->PopState();
 }
 
+/**
+ * Choose the mip level to draw with for the current transform.
+ *
+ * This is the smallest level that still has at least as many
+ * pixels as the polygon covers on the device, so the image is
+ * never magnified by more than the full size image would be.
+ * The transform is in logical units, so it is multiplied by the
+ * content scale to get device pixels on high DPI displays.
+ * Levels are created as they are needed.
+ *
+ * @param graphics Graphics object we are drawing on
+ * @return Index into mMipImages
+ */
+int Polygon::SelectMipLevel(const std::shared_ptr<wxGraphicsContext> &graphics)
+{
+    double a, b, c, d;
+    graphics->GetTransform().Get(&a, &b, &c, &d);
+
+    // Device pixels per polygon unit. Rotation does not change this.
+    double scale = sqrt(fabs(a * d - b * c)) * graphics->GetContentScaleFactor();
+    double deviceWid = mImageSize.m_x * scale;
+    double deviceHit = mImageSize.m_y * scale;
+
+    size_t level = 0;
+    for( ; ; level++)
+    {
+        auto &mip = mMipImages[level];
+        int nextWid = mip.GetWidth() / 2;
+        int nextHit = mip.GetHeight() / 2;
+        if(nextWid < 1 || nextHit < 1 || nextWid < deviceWid || nextHit < deviceHit)
+        {
+            break;
+        }
+
+        if(level + 1 == mMipImages.size())
+        {
+            mMipImages.push_back(mip.ShrinkBy(2, 2));
+        }
+    }
+
+    return (int)level;
+}
+
+/**
+ * Add coverage for a horizontal span of a scanline
+ * @param coverage Coverage for each pixel in the row
+ * @param u0 Left end of the span in pixels
+ * @param u1 Right end of the span in pixels
+ * @param weight Weight of the scanline
+ */
+static void AddSpanCoverage(std::vector<float> &coverage, double u0, double u1, float weight)
+{
+    double wid = (double)coverage.size();
+    u0 = std::max(u0, 0.0);
+    u1 = std::min(u1, wid);
+    if(u1 <= u0)
+    {
+        return;
+    }
+
+    int i0 = (int)u0;
+    int i1 = (int)u1;
+    if(i0 == i1)
+    {
+        coverage[i0] += float(u1 - u0) * weight;
+        return;
+    }
+
+    coverage[i0] += float(i0 + 1 - u0) * weight;
+    for(int i=i0+1; i<i1; i++)
+    {
+        coverage[i] += weight;
+    }
+
+    if(i1 < (int)coverage.size())
+    {
+        coverage[i1] += float(u1 - i1) * weight;
+    }
+}
+
+/**
+ * Multiply the image alpha by how much of each pixel
+ * the polygon covers.
+ *
+ * The image is drawn stretched over the bounding box of
+ * the polygon (mImageTopLeft, mImageSize). Circles use the
+ * exact distance to the edge. Other polygons are scanned
+ * several times per pixel row with exact horizontal coverage,
+ * using the odd/even rule the clip region used.
+ *
+ * @param image Image with an alpha channel
+ */
+void Polygon::MaskImage(wxImage &image)
+{
+    int wid = image.GetWidth();
+    int hit = image.GetHeight();
+    unsigned char *alpha = image.GetAlpha();
+
+    // Size of one image pixel in polygon units
+    double pixelWid = mImageSize.m_x / wid;
+    double pixelHit = mImageSize.m_y / hit;
+    if(pixelWid <= 0 || pixelHit <= 0)
+    {
+        memset(alpha, 0, (size_t)wid * hit);
+        return;
+    }
+
+    // Polygon Y for a position down the image in pixels
+    auto rowY = [this, pixelHit](double v) {
+        return mInvertedY ? mImageTopLeft.m_y + mImageSize.m_y - v * pixelHit
+                          : mImageTopLeft.m_y + v * pixelHit;
+    };
+
+    std::vector<float> coverage(wid);
+
+    if(mIsCircle)
+    {
+        double radius = Radius();
+        double pixelSize = (pixelWid + pixelHit) / 2;
+        for(int j=0; j<hit; j++)
+        {
+            double py = rowY(j + 0.5);
+            for(int i=0; i<wid; i++)
+            {
+                double px = mImageTopLeft.m_x + (i + 0.5) * pixelWid;
+                double edge = (radius - sqrt(px * px + py * py)) / pixelSize + 0.5;
+                coverage[i] = (float)std::min(std::max(edge, 0.0), 1.0);
+            }
+
+            unsigned char *row = alpha + (size_t)j * wid;
+            for(int i=0; i<wid; i++)
+            {
+                row[i] = (unsigned char)(row[i] * coverage[i] + 0.5f);
+            }
+        }
+
+        return;
+    }
+
+    const int Subsamples = 4;
+    std::vector<double> crossings;
+    for(int j=0; j<hit; j++)
+    {
+        std::fill(coverage.begin(), coverage.end(), 0.0f);
+
+        for(int s=0; s<Subsamples; s++)
+        {
+            double py = rowY(j + (s + 0.5) / Subsamples);
+
+            // Where this scanline crosses the polygon edges, in pixels
+            crossings.clear();
+            for(size_t k=0; k<mPoints.size(); k++)
+            {
+                auto &p0 = mPoints[k];
+                auto &p1 = mPoints[(k + 1) % mPoints.size()];
+                if((p0.m_y <= py) != (p1.m_y <= py))
+                {
+                    double px = p0.m_x + (py - p0.m_y) * (p1.m_x - p0.m_x) / (p1.m_y - p0.m_y);
+                    crossings.push_back((px - mImageTopLeft.m_x) / pixelWid);
+                }
+            }
+
+            std::sort(crossings.begin(), crossings.end());
+            for(size_t k=0; k+1<crossings.size(); k+=2)
+            {
+                AddSpanCoverage(coverage, crossings[k], crossings[k+1], 1.0f / Subsamples);
+            }
+        }
+
+        unsigned char *row = alpha + (size_t)j * wid;
+        for(int i=0; i<wid; i++)
+        {
+            row[i] = (unsigned char)(row[i] * std::min(coverage[i], 1.0f) + 0.5f);
+        }
+    }
+}
+
 /**
  * Convenience function to draw a crosshair.
  * @param graphics Graphics object to draw on
@@ -419,7 +622,7 @@ void Polygon::DrawImagePolygon(std::shared_ptr<wxGraphicsContext> graphics, doub
  * @param size Size (width and height) of the crosshair in pixels (optional, default=
  * @param color Crosshair color (optional, default=red)
  */
-void Polygon::DrawCrosshair(std::shared_ptr<wxGraphicsContext> graphics, double x, double y,
+void Polygon::DrawCrosshair(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y,
         int size, wxColor color)
 {
     wxPen pen(color);
@@ -504,15 +707,16 @@ void Polygon::SetOpacity(double opacity)
 
         // We have an opacity change
         mOpacity = opacity;
-#ifdef WIN32
         mBitmapDirty = true;
-#endif
     }
 }
 
 
 /**
  * Get the average luminance of a block of pixels in a supplied image.
+ *
+ * Uses a summed area table of the image, so the cost does
+ * not depend on the size of the block.
  * @param x Top left X in pixels
  * @param y Top left Y in pixels
  * @param wid Width of the block to average
@@ -523,39 +727,80 @@ double Polygon::AverageLuminance(int x, int y, int wid, int hit)
 {
     assert(mMode == Mode::Image);
 
-    double sum = 0;
-    int cnt = 0;
-
-    for (int i = x; i < x + wid; i++)
+    if(!Assert(mImage != nullptr, L"You must specify an image before you can call AverageLuminance()"))
     {
-        if (i < 0 || i >= GetImageWidth())
-        {
-            continue;
-        }
-
-        for (int j = y; j < y + hit; j++)
-        {
-            if (j < 0 || j >= GetImageHeight())
-            {
-                continue;
-            }
+        return 0;
+    }
 
-            double red = mImage->GetRed(i, j);
-            double grn = mImage->GetGreen(i, j);
-            double blu = mImage->GetBlue(i, j);
-            sum += red + grn + blu;
-            cnt += 3;
-        }
+    if(mLuminanceTable.empty())
+    {
+        BuildLuminanceTable();
     }
 
-    if (cnt == 0)
+    // Clip the block to the image
+    int imageWid = mImage->GetWidth();
+    int imageHit = mImage->GetHeight();
+    int x0 = std::max(x, 0);
+    int y0 = std::max(y, 0);
+    int x1 = std::min(x + wid, imageWid);
+    int y1 = std::min(y + hit, imageHit);
+    if(x1 <= x0 || y1 <= y0)
     {
         return 0;
     }
 
+    size_t stride = imageWid + 1;
+    auto &table = mLuminanceTable;
+    uint64_t sum = table[y1 * stride + x1] - table[y0 * stride + x1]
+            - table[y1 * stride + x0] + table[y0 * stride + x0];
+    double cnt = 3.0 * (x1 - x0) * (y1 - y0);
+
     return (sum / cnt) / 255.0;
 }
 
+/**
+ * Build the summed area table used by AverageLuminance.
+ *
+ * Entry (x, y) of the table is the sum of red + green + blue
+ * over all pixels above and to the left of pixel (x, y). The
+ * table has an extra row and column of zeros at the top and
+ * left so blocks at the edge need no special cases.
+ */
+void Polygon::BuildLuminanceTable()
+{
+    int wid = mImage->GetWidth();
+    int hit = mImage->GetHeight();
+    size_t stride = wid + 1;
+
+    mLuminanceTable.assign(stride * (hit + 1), 0);
+
+    const unsigned char *rgb = mImage->GetData();
+    std::vector<uint32_t> rowSums(wid);
+    for(int j=0; j<hit; j++)
+    {
+        // Pixel sums for this row. These loops have no dependencies
+        // between iterations, so the compiler can vectorize them.
+        const unsigned char *row = rgb + (size_t)j * wid * 3;
+        for(int i=0; i<wid; i++)
+        {
+            rowSums[i] = row[i * 3] + row[i * 3 + 1] + row[i * 3 + 2];
+        }
+
+        // Running total along the row
+        for(int i=1; i<wid; i++)
+        {
+            rowSums[i] += rowSums[i - 1];
+        }
+
+        const uint64_t *above = &mLuminanceTable[j * stride + 1];
+        uint64_t *dst = &mLuminanceTable[(j + 1) * stride + 1];
+        for(int i=0; i<wid; i++)
+        {
+            dst[i] = above[i] + rowSums[i];
+        }
+    }
+}
+
 /**
  * Get the center point for the polygon
  * @return Center point (average of all points)
@@ -621,6 +866,35 @@ wxRect2DDouble Polygon::BoundingBox()
     return box;
 }
 
+/**
+ * Get a bounding box that encloses the polygon as it
+ * would be drawn by DrawPolygon
+ * @param x X location to draw in pixels
+ * @param y Y location to draw in pixels
+ * @param rotation Rotation in turns (0-1)
+ * @return Bounding box
+ */
+wxRect2DDouble Polygon::BoundingBox(double x, double y, double rotation)
+{
+    auto box = BoundingBox();
+
+    double cs = cos(rotation * M_PI * 2);
+    double sn = sin(rotation * M_PI * 2);
+
+    wxPoint2DDouble corners[] = {box.GetLeftTop(), box.GetRightTop(),
+                                 box.GetLeftBottom(), box.GetRightBottom()};
+
+    wxRect2DDouble placed(x + corners[0].m_x * cs - corners[0].m_y * sn,
+                          y + corners[0].m_x * sn + corners[0].m_y * cs, 0, 0);
+    for(auto corner : corners)
+    {
+        placed.Union(wxPoint2DDouble(x + corner.m_x * cs - corner.m_y * sn,
+                                     y + corner.m_x * sn + corner.m_y * cs));
+    }
+
+    return placed;
+}
+
 
 //editor-fold desc="Code to support the deferred assertion message box" defaultstate="collapsed">
 
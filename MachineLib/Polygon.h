@@ -2,7 +2,7 @@
  * @file Polygon.h
  *
  * @author Charles Owen
- * @version 1.05
+ * @version 1.14
  *
  * Generic polygon class that is used to make shapes we
  * will use in our project.
@@ -14,6 +14,15 @@
  * 1.03 Put into cse335 namespace, opacity support
  * 1.04 Added Circle function
  * 1.05 Special version that works with inverted Y axis
+ * 1.06 Images are shared through ImageCache
+ * 1.07 Added placed BoundingBox
+ * 1.08 Polygon mask baked into the image alpha instead of clipping
+ * 1.09 Opacity without transparency layers on all platforms
+ * 1.10 Mip chain selected from the device scale
+ * 1.11 AverageLuminance uses a summed area table
+ * 1.12 Image drawing traced with TRACE_ZONE
+ * 1.13 Graphics context passed by const reference
+ * 1.14 Mip level selection includes the content scale
  */
 
 #pragma once
@@ -33,8 +42,11 @@ namespace cse335 {
         /// Default number of steps when drawing a circle
         static const int DefaultCircleSteps = 32;
 
-        void DrawColorPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double r);
-        void DrawImagePolygon(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double r);
+        void DrawColorPolygon(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, double r);
+        void DrawImagePolygon(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, double r);
+        void MaskImage(wxImage &image);
+        int SelectMipLevel(const std::shared_ptr<wxGraphicsContext> &graphics);
+        void BuildLuminanceTable();
 
         /// Graphics path to use to draw
         wxGraphicsPath mPath;
@@ -56,20 +68,29 @@ namespace cse335 {
         /// The current mode
         Mode mMode = Mode::Unset;
 
-        /// The basic texture image we load
-        std::unique_ptr<wxImage> mImage;
+        /// The basic texture image we load, shared through ImageCache
+        std::shared_ptr<wxImage> mImage;
 
-        /// The graphics bitmap we actually draw
-        wxGraphicsBitmap mGraphicsBitmap;
+        /// The image with the polygon mask in its alpha channel
+        wxImage mMaskedImage;
 
-        /// The image clip region
-        wxRegion mImageClipRegion;
+        /// Mip chain for mMaskedImage. Level 0 is mMaskedImage and
+        /// each level after that is half the size of the one before.
+        std::vector<wxImage> mMipImages;
 
-        /// What is the top left point for the clip region?
-        wxPoint2DDouble mImageClipRegionTopLeft;
+        /// The graphics bitmaps we actually draw for each mip level,
+        /// with the opacity applied. Created when first needed.
+        std::vector<wxGraphicsBitmap> mMipBitmaps;
 
-        /// What is the size of the clip region?
-        wxPoint2DDouble mImageClipRegionSize;
+        /// What is the top left point of the region the image covers?
+        wxPoint2DDouble mImageTopLeft;
+
+        /// What is the size of the region the image covers?
+        wxPoint2DDouble mImageSize;
+
+        /// Summed area table of red + green + blue for AverageLuminance,
+        /// built the first time it is needed
+        std::vector<uint64_t> mLuminanceTable;
 
         /// Set true when DrawPolygon is called
         bool mHasDrawn = false;
@@ -77,7 +98,7 @@ namespace cse335 {
         /// Opacity of the polygon - value range to 0 to 1
         double mOpacity = 1.0;
 
-        /// Forces the bitmap to be reloaded
+        /// Forces the bitmaps to be recreated from mMipImages
         bool mBitmapDirty = true;
 
 #ifdef POLYGON_DEFAULT_INVERTEDY
@@ -138,7 +159,7 @@ namespace cse335 {
 
         void SetImage(std::wstring filename);
 
-        void DrawPolygon(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double rotation);
+        void DrawPolygon(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, double rotation);
 
         virtual void SetOpacity(double opacity);
 
@@ -155,7 +176,7 @@ namespace cse335 {
         void BottomCenteredRectangle(wxSize size) { BottomCenteredRectangle(size.x, size.y);}
 
         void
-        DrawCrosshair(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, int size = 10, wxColor color = *wxRED);
+        DrawCrosshair(const std::shared_ptr<wxGraphicsContext> &graphics, double x, double y, int size = 10, wxColor color = *wxRED);
 
         double AverageLuminance(int x, int y, int wid, int hit);
 
@@ -195,6 +216,7 @@ namespace cse335 {
 
         wxPoint2DDouble Center();
         wxRect2DDouble BoundingBox();
+        wxRect2DDouble BoundingBox(double x, double y, double rotation);
     };
 
 
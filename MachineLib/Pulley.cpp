@@ -47,20 +47,7 @@ void Pulley::Reset()
     mSpeed = 0;
     mRotation = 0;
     mBeltRockRate = 1;
-}
-
-/**
- * Update the animation of this pulley
- * @param elapsed
- */
-void Pulley::Update(double elapsed)
-{
-    //
-    // If this pulley is a source :
-    // update its sink to rotate at its speed
-    //
-    if (GetSource() && mSource.GetSink())
-        mSource.GetSink()->Rotate(mRotation, mSpeed);
+    mSource.Reset();
 }
 
 
@@ -68,7 +55,7 @@ void Pulley::Update(double elapsed)
  * Draw this pulley
  * @param graphics The graphics context object to draw on
  */
-void Pulley::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void Pulley::Draw(RenderContext &graphics)
 {
     //
     // Draw the belts first so that they appear to slot over the pulleys
@@ -78,7 +65,7 @@ void Pulley::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     //
     // Draw the pulley
     //
-    mPulley.DrawPolygon(graphics, mPosition.m_x, mPosition.m_y, mRotation);
+    mPulley.DrawPolygon(graphics.GetGraphics(), mPosition.m_x, mPosition.m_y, mRotation);
 }
 
 /**
@@ -89,15 +76,12 @@ void Pulley::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 void Pulley::Rotate(double rotation, double speed)
 {
     //
-    // The pulley ratio is 0 (False) if this pulley is not being
-    // driven by another pulley
-    //
-    // Bigger pulleys should rotate slower than smaller pulleys
-    // Bigger pulleys should also transfer slower speed than
-    // smaller pulleys to their rotation sinks
+    // Any pulley ratio has already been applied by the drivetrain.
+    // This pulley is also a source, so it turns its own sinks.
     //
-    mSpeed = mPulleyRatio ? speed * mPulleyRatio : speed;
-    mRotation = mPulleyRatio ? rotation * mPulleyRatio : rotation;
+    mSpeed = speed;
+    mRotation = rotation;
+    mSource.Rotate(mRotation, mSpeed);
 }
 
 /**
@@ -111,15 +95,13 @@ void Pulley::Drive(std::shared_ptr<Pulley> drivenPulley)
     //
     // The current pulley is a Source / Driving pulley
     //
-    // Set the pulley ratio of the Second / Driven / Sink Pulley
-    // using its radius and the radius of its source. This will
-    // be used to scale its speed if the sink & source radii differ:
+    // The belt drives the Second / Driven / Sink Pulley at the
+    // ratio of their radii, so bigger pulleys rotate slower and
+    // also transfer slower speed to their rotation sinks:
     //
     // Pulley Ratio : drivingPulley->mRadius / drivenPulley->mRadius
     //
-    mDrivenPulley->mPulleyRatio = mRadius / mDrivenPulley->mRadius;
-
-    mSource.AddSink(mDrivenPulley);
+    mSource.AddSink(mDrivenPulley, mRadius / mDrivenPulley->mRadius);
 }
 
 /**
@@ -135,10 +117,9 @@ void Pulley::SetImage(const std::wstring &imagesDir)
  * Draw belts connecting this pulley to its driven pulley if applicable
  * @param graphics The graphics context object to draw on
  */
-void Pulley::DrawBelts(std::shared_ptr<wxGraphicsContext> graphics)
+void Pulley::DrawBelts(RenderContext &graphics)
 {
-    wxPen beltPen(*wxBLACK, 2);
-    graphics->SetPen(beltPen);
+    graphics.SetPen(*wxBLACK, 2);
 
     //
     // A source pulley will have a driven pulley (non-null)
@@ -20,14 +20,13 @@
 /**
  * Class for a pulley
  */
-class Pulley : public Component
+class Pulley final : public Component
 {
 private:
 
     double mSpeed = 0;       ///< The translational speed of this pulley
     double mRadius = 0;      ///< The radius of this pulley
     double mRotation = 0;    ///< The rotation angle for this pulley
-    double mPulleyRatio = 0; ///< Radius of Driven Pulley / Radius of Driving Pulley
 
     RotationSink mSink;      ///< Rotation sink for this pulley (if it is "driven")
     RotationSource mSource;  ///< Rotation source for this pulley (if it is "driving")
@@ -46,22 +45,27 @@ public:
 
     double ComputeBeta();
     void Reset() override;
-    void Update(double elapsed) override;
     void Drive(std::shared_ptr<Pulley> drivenPulley);
     void Rotate(double rotation, double speed) override;
-    void DrawBelts(std::shared_ptr<wxGraphicsContext> graphics);
+    void DrawBelts(RenderContext &graphics);
     void RockBelts(wxPoint2DDouble& belt1P1, wxPoint2DDouble& belt1P2,
                    wxPoint2DDouble& belt2P1, wxPoint2DDouble& belt2P2);
-    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void Draw(RenderContext &graphics) override;
 
     void SetRotation(double rotation);
     void SetImage(const std::wstring &imagesDir);
     void SetPosition(double x, double y) override;
     void SetPosition(wxPoint2DDouble position) override;
 
+    /**
+     * Get the name of this type of component, for reporting
+     * @return Type name
+     */
+    std::wstring GetTypeName() const override { return L"Pulley"; }
+
     RotationSink *GetSink();
     double GetRotation() const;
-    RotationSource *GetSource();
+    RotationSource *GetSource() override;
     std::shared_ptr<Pulley> GetDrivenPulley() const;
 
 
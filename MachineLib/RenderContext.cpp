@@ -0,0 +1,137 @@
+/**
+ * @file RenderContext.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "RenderContext.h"
+
+std::map<std::tuple<wxGraphicsRenderer *, wxUint32, double, int>, wxGraphicsPen> RenderContext::mPens;
+std::map<std::tuple<wxGraphicsRenderer *, wxUint32>, wxGraphicsBrush> RenderContext::mBrushes;
+std::map<std::tuple<wxGraphicsRenderer *, double, int, int, wxUint32>, wxGraphicsFont> RenderContext::mFonts;
+
+/// Most objects kept in one pool. A pool is emptied when it
+/// gets this large, so styles computed per frame can't grow
+/// it without bound.
+const size_t MaxPooled = 256;
+
+/**
+ * Pack a colour into one value for use in a key
+ * @param colour Colour to pack
+ * @return Red, green, blue and alpha in one value
+ */
+static wxUint32 ColourKey(const wxColour &colour)
+{
+    return ((wxUint32)colour.Red() << 24) | ((wxUint32)colour.Green() << 16) |
+        ((wxUint32)colour.Blue() << 8) | colour.Alpha();
+}
+
+/**
+ * Constructor
+ * @param graphics The graphics context to draw on
+ */
+RenderContext::RenderContext(const std::shared_ptr<wxGraphicsContext> &graphics) : mGraphics(graphics)
+{
+}
+
+/**
+ * Set the pen for stroking
+ * @param colour Pen colour
+ * @param width Pen width
+ * @param style Pen style
+ */
+void RenderContext::SetPen(const wxColour &colour, double width, wxPenStyle style)
+{
+    auto key = std::make_tuple(mGraphics->GetRenderer(), ColourKey(colour), width, (int)style);
+    auto found = mPens.find(key);
+    if (found == mPens.end())
+    {
+        if (mPens.size() >= MaxPooled)
+        {
+            mPens.clear();
+        }
+
+        found = mPens.emplace(key, mGraphics->CreatePen(wxGraphicsPenInfo(colour, width, style))).first;
+    }
+
+    mGraphics->SetPen(found->second);
+}
+
+/**
+ * Set the brush for filling
+ * @param colour Brush colour
+ */
+void RenderContext::SetBrush(const wxColour &colour)
+{
+    auto key = std::make_tuple(mGraphics->GetRenderer(), ColourKey(colour));
+    auto found = mBrushes.find(key);
+    if (found == mBrushes.end())
+    {
+        if (mBrushes.size() >= MaxPooled)
+        {
+            mBrushes.clear();
+        }
+
+        found = mBrushes.emplace(key, mGraphics->CreateBrush(wxBrush(colour))).first;
+    }
+
+    mGraphics->SetBrush(found->second);
+}
+
+/**
+ * Set the font for text
+ * @param pixelSize Font height in pixels
+ * @param colour Text colour
+ * @param family Font family
+ * @param weight Font weight
+ */
+void RenderContext::SetFont(double pixelSize, const wxColour &colour, wxFontFamily family, wxFontWeight weight)
+{
+    auto key = std::make_tuple(mGraphics->GetRenderer(), pixelSize, (int)family, (int)weight, ColourKey(colour));
+    auto found = mFonts.find(key);
+    if (found == mFonts.end())
+    {
+        if (mFonts.size() >= MaxPooled)
+        {
+            mFonts.clear();
+        }
+
+        wxFont font(wxSize(0, (int)lround(pixelSize)),
+                family,
+                wxFONTSTYLE_NORMAL,
+                weight);
+        found = mFonts.emplace(key, mGraphics->CreateFont(font, colour)).first;
+    }
+
+    mGraphics->SetFont(found->second);
+}
+
+/**
+ * Turn stroking off
+ */
+void RenderContext::SetTransparentPen()
+{
+    mGraphics->SetPen(wxNullGraphicsPen);
+}
+
+/**
+ * Turn filling off
+ */
+void RenderContext::SetTransparentBrush()
+{
+    mGraphics->SetBrush(wxNullGraphicsBrush);
+}
+
+/**
+ * Empty the pools.
+ *
+ * Call before the program exits. The pooled objects belong to
+ * the graphics renderer and must be released while it still exists,
+ * not during static destruction.
+ */
+void RenderContext::Clear()
+{
+    mPens.clear();
+    mBrushes.clear();
+    mFonts.clear();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file RenderContext.h
+ * @author Mate Narh
+ *
+ * What the Draw functions draw on: a graphics context
+ * plus pooled pens, brushes and fonts.
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_RENDERCONTEXT_H
+#define CANADIANEXPERIENCE_MACHINELIB_RENDERCONTEXT_H
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+/**
+ * What the Draw functions draw on: a graphics context
+ * plus pooled pens, brushes and fonts.
+ *
+ * It is passed down the drawing chains by reference, so the
+ * graphics context reference count is not touched per call.
+ * Use -> to reach the wxGraphicsContext itself.
+ *
+ * Graphics pens, brushes and fonts belong to the renderer
+ * rather than to one graphics context, so the pools are shared
+ * by every RenderContext and survive from one paint to the
+ * next. Drawing only happens on the main thread, so the pools
+ * are not locked.
+ */
+class RenderContext
+{
+private:
+    /// The graphics context we draw on
+    std::shared_ptr<wxGraphicsContext> mGraphics;
+
+    /// Pens by renderer, colour, width and style
+    static std::map<std::tuple<wxGraphicsRenderer *, wxUint32, double, int>, wxGraphicsPen> mPens;
+
+    /// Brushes by renderer and colour
+    static std::map<std::tuple<wxGraphicsRenderer *, wxUint32>, wxGraphicsBrush> mBrushes;
+
+    /// Fonts by renderer, pixel size, family, weight and colour
+    static std::map<std::tuple<wxGraphicsRenderer *, double, int, int, wxUint32>, wxGraphicsFont> mFonts;
+
+public:
+    explicit RenderContext(const std::shared_ptr<wxGraphicsContext> &graphics);
+
+    /// Default constructor (disabled)
+    RenderContext() = delete;
+
+    /// Copy constructor (disabled)
+    RenderContext(const RenderContext &) = delete;
+
+    /// Assignment operator
+    void operator=(const RenderContext &) = delete;
+
+    /**
+     * Access the graphics context
+     * @return Graphics context we draw on
+     */
+    wxGraphicsContext *operator->() const { return mGraphics.get(); }
+
+    /**
+     * Get the graphics context for code that keeps or shares it
+     * @return Graphics context we draw on
+     */
+    const std::shared_ptr<wxGraphicsContext> &GetGraphics() const { return mGraphics; }
+
+    void SetPen(const wxColour &colour, double width = 1, wxPenStyle style = wxPENSTYLE_SOLID);
+    void SetBrush(const wxColour &colour);
+    void SetFont(double pixelSize, const wxColour &colour,
+            wxFontFamily family = wxFONTFAMILY_SWISS, wxFontWeight weight = wxFONTWEIGHT_NORMAL);
+    void SetTransparentPen();
+    void SetTransparentBrush();
+
+    static void Clear();
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_RENDERCONTEXT_H
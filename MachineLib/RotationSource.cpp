@@ -16,19 +16,33 @@ RotationSource::RotationSource()
 }
 
 /**
- * Assign this rotation source its rotation sink
+ * Add a rotation sink for this rotation source to drive
  * @param sink The new rotation sink
+ * @param ratio Sink rotation per unit of source rotation
  */
-void RotationSource::AddSink(std::shared_ptr<Component> sink)
+void RotationSource::AddSink(std::shared_ptr<Component> sink, double ratio)
 {
-    mSink = sink;
+    mSinks.push_back({sink, ratio});
 }
 
 /**
- * Get the rotation sink that this rotation source drives
- * @return The rotation sink that this rotation source drives
+ * Set the current rotation of this source
+ * @param rotation The new rotation
+ * @param speed The new speed
  */
-std::shared_ptr<Component> RotationSource::GetSink() const
+void RotationSource::Rotate(double rotation, double speed)
 {
-    return mSink;
+    mRotation = rotation;
+    mSpeed = speed;
+    mDriving = true;
+}
+
+/**
+ * Stop driving the sinks until the source is rotated again
+ */
+void RotationSource::Reset()
+{
+    mRotation = 0;
+    mSpeed = 0;
+    mDriving = false;
 }
@@ -12,19 +12,62 @@ class Component;
 
 /**
  * Class for a rotation source
+ *
+ * A source can drive any number of sinks, each through its
+ * own ratio. The source only records its current rotation;
+ * the machine's Drivetrain passes it on to the sinks.
  */
 class RotationSource
 {
+public:
+    /**
+     * A component this source drives
+     */
+    struct Sink
+    {
+        std::shared_ptr<Component> mComponent; ///< The component that is driven
+        double mRatio = 1;                     ///< Sink rotation per unit of source rotation
+    };
+
 private:
-    /// The rotation sink that this rotation source rotates or drives
-    std::shared_ptr<Component> mSink = nullptr;
+    /// The rotation sinks that this rotation source rotates or drives
+    std::vector<Sink> mSinks;
+
+    double mRotation = 0;  ///< Current rotation of this source
+    double mSpeed = 0;     ///< Current speed of this source
+    bool mDriving = false; ///< Has this source been rotated since it was reset?
 
 public:
 
     RotationSource();
 
-    void AddSink(std::shared_ptr<Component> sink);
-    std::shared_ptr<Component> GetSink() const;
+    void AddSink(std::shared_ptr<Component> sink, double ratio = 1);
+    void Rotate(double rotation, double speed);
+    void Reset();
+
+    /**
+     * Get the rotation sinks that this rotation source drives
+     * @return Sinks in the order they were added
+     */
+    const std::vector<Sink> &GetSinks() const { return mSinks; }
+
+    /**
+     * Get the current rotation of this source
+     * @return Rotation in turns
+     */
+    double GetRotation() const { return mRotation; }
+
+    /**
+     * Get the current speed of this source
+     * @return Speed in turns per second
+     */
+    double GetSpeed() const { return mSpeed; }
+
+    /**
+     * Is this source driving its sinks?
+     * @return true if the source has been rotated since it was reset
+     */
+    bool IsDriving() const { return mDriving; }
 
     /// Copy constructor (disabled)
     RotationSource(const RotationSource &) = delete;
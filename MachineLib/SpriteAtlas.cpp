@@ -0,0 +1,198 @@
+/**
+ * @file SpriteAtlas.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include "SpriteAtlas.h"
+#include "ImageCache.h"
+
+/// Number of mip levels we make below the full size atlas
+const int MipLevels = 4;
+
+/// Frames start on multiples of this many pixels, so every
+/// mip level splits into frames on whole pixels
+const int FrameAlignment = 1 << MipLevels;
+
+std::map<std::wstring, std::shared_ptr<SpriteAtlas>> SpriteAtlas::mAtlases;
+
+/**
+ * Round a size up to a multiple of FrameAlignment
+ * @param size Size in pixels
+ * @return Aligned size
+ */
+static int AlignFrame(int size)
+{
+    return (size + FrameAlignment - 1) / FrameAlignment * FrameAlignment;
+}
+
+/**
+ * Get the shared atlas for a list of frame files, creating it if needed
+ * @param filenames Frame image files in frame order
+ * @return Shared atlas
+ */
+std::shared_ptr<SpriteAtlas> SpriteAtlas::Get(const std::vector<std::wstring> &filenames)
+{
+    std::wstring key;
+    for (auto &filename : filenames)
+    {
+        key += filename + L"\n";
+    }
+
+    auto &atlas = mAtlases[key];
+    if (atlas == nullptr)
+    {
+        atlas = std::make_shared<SpriteAtlas>(filenames);
+    }
+
+    return atlas;
+}
+
+/**
+ * Remove all atlases from the cache.
+ *
+ * Call before the program exits. The atlas graphics bitmaps
+ * belong to the graphics renderer and must be released while
+ * it still exists, not during static destruction.
+ */
+void SpriteAtlas::Clear()
+{
+    mAtlases.clear();
+}
+
+/**
+ * Constructor
+ * @param filenames Frame image files in frame order
+ */
+SpriteAtlas::SpriteAtlas(const std::vector<std::wstring> &filenames)
+{
+    //
+    // Lay the frames out in a row
+    //
+    std::vector<std::shared_ptr<wxImage>> images;
+    int atlasWid = 0;
+    int atlasHit = 1;
+    for (auto &filename : filenames)
+    {
+        auto image = ImageCache::Get(filename);
+        int wid = image != nullptr ? image->GetWidth() : 1;
+        int hit = image != nullptr ? image->GetHeight() : 1;
+
+        mFrames.push_back(wxRect(atlasWid, 0, wid, hit));
+        images.push_back(image);
+
+        atlasWid += AlignFrame(wid);
+        atlasHit = std::max(atlasHit, hit);
+    }
+
+    atlasWid = std::max(atlasWid, 1);
+    atlasHit = AlignFrame(atlasHit);
+
+    //
+    // Copy the frames into a transparent atlas image
+    //
+    wxImage atlas(atlasWid, atlasHit);
+    atlas.InitAlpha();
+    memset(atlas.GetAlpha(), 0, (size_t)atlasWid * atlasHit);
+
+    unsigned char *atlasRgb = atlas.GetData();
+    unsigned char *atlasAlpha = atlas.GetAlpha();
+    for (size_t f = 0; f < images.size(); f++)
+    {
+        auto &image = images[f];
+        if (image == nullptr)
+        {
+            continue;
+        }
+
+        auto &rect = mFrames[f];
+        const unsigned char *rgb = image->GetData();
+        const unsigned char *alpha = image->HasAlpha() ? image->GetAlpha() : nullptr;
+        for (int j = 0; j < rect.height; j++)
+        {
+            size_t dst = (size_t)j * atlasWid + rect.x;
+            size_t src = (size_t)j * rect.width;
+            memcpy(atlasRgb + dst * 3, rgb + src * 3, (size_t)rect.width * 3);
+            if (alpha != nullptr)
+            {
+                memcpy(atlasAlpha + dst, alpha + src, rect.width);
+            }
+            else
+            {
+                memset(atlasAlpha + dst, wxIMAGE_ALPHA_OPAQUE, rect.width);
+            }
+        }
+    }
+
+    //
+    // Build the mip chain
+    //
+    mLevels.push_back(atlas);
+    for (int level = 1; level <= MipLevels; level++)
+    {
+        auto &previous = mLevels.back();
+        if (previous.GetWidth() < 2 || previous.GetHeight() < 2)
+        {
+            break;
+        }
+
+        mLevels.push_back(previous.ShrinkBy(2, 2));
+    }
+
+    mLevelBitmaps.resize(mLevels.size());
+    mFrameBitmaps.resize(mLevels.size(), std::vector<wxGraphicsBitmap>(mFrames.size()));
+}
+
+/**
+ * Choose the mip level to draw a frame with for the current transform
+ * @param graphics Graphics object we are drawing on
+ * @param frame Frame to draw
+ * @param wid Width the frame is drawn in the current units
+ * @return Index into mLevels
+ */
+int SpriteAtlas::SelectLevel(const std::shared_ptr<wxGraphicsContext> &graphics, int frame, double wid)
+{
+    double a, b, c, d;
+    graphics->GetTransform().Get(&a, &b, &c, &d);
+    double deviceWid = wid * sqrt(fabs(a * d - b * c)) * graphics->GetContentScaleFactor();
+
+    int level = 0;
+    while (level + 1 < (int)mLevels.size() && (mFrames[frame].width >> (level + 1)) >= deviceWid)
+    {
+        level++;
+    }
+
+    return level;
+}
+
+/**
+ * Draw a frame stretched over a rectangle. The top row of
+ * the frame image is drawn at y.
+ * @param graphics Graphics object to draw on
+ * @param frame Frame to draw
+ * @param x Left of the rectangle
+ * @param y Top of the rectangle
+ * @param wid Width of the rectangle
+ * @param hit Height of the rectangle
+ */
+void SpriteAtlas::DrawFrame(const std::shared_ptr<wxGraphicsContext> &graphics, int frame,
+        double x, double y, double wid, double hit)
+{
+    int level = SelectLevel(graphics, frame, wid);
+
+    auto &bitmap = mFrameBitmaps[level][frame];
+    if (bitmap.IsNull())
+    {
+        auto &atlasBitmap = mLevelBitmaps[level];
+        if (atlasBitmap.IsNull())
+        {
+            atlasBitmap = graphics->CreateBitmapFromImage(mLevels[level]);
+        }
+
+        auto &rect = mFrames[frame];
+        bitmap = graphics->CreateSubBitmap(atlasBitmap, rect.x >> level, rect.y >> level,
+                std::max(rect.width >> level, 1), std::max(rect.height >> level, 1));
+    }
+
+    graphics->DrawBitmap(bitmap, x, y, wid, hit);
+}
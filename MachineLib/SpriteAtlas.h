@@ -0,0 +1,71 @@
+/**
+ * @file SpriteAtlas.h
+ * @author Mate Narh
+ *
+ * Animation frames packed into one shared image
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_SPRITEATLAS_H
+#define CANADIANEXPERIENCE_MACHINELIB_SPRITEATLAS_H
+
+#include <map>
+
+/**
+ * Animation frames packed into one shared image.
+ *
+ * The frames are laid out in a row in a single image, so all
+ * of them share one graphics bitmap. Each frame is drawn as a
+ * sub-bitmap of it. Atlases are shared by everything that asks
+ * for the same list of frame files, so every hamster in every
+ * machine uses the same one.
+ *
+ * Like Polygon, the atlas keeps a mip chain and draws from the
+ * level closest to the size the frame covers on the device.
+ */
+class SpriteAtlas
+{
+private:
+    /// Where each frame is in the full size atlas image
+    std::vector<wxRect> mFrames;
+
+    /// Mip chain for the atlas image. Each level is half
+    /// the size of the one before.
+    std::vector<wxImage> mLevels;
+
+    /// Graphics bitmap for each level, created when first needed
+    std::vector<wxGraphicsBitmap> mLevelBitmaps;
+
+    /// Sub-bitmap for each frame in each level, created when first needed
+    std::vector<std::vector<wxGraphicsBitmap>> mFrameBitmaps;
+
+    /// Atlases that have been created, by the list of frame files
+    static std::map<std::wstring, std::shared_ptr<SpriteAtlas>> mAtlases;
+
+    int SelectLevel(const std::shared_ptr<wxGraphicsContext> &graphics, int frame, double wid);
+
+public:
+    SpriteAtlas(const std::vector<std::wstring> &filenames);
+
+    /// Default constructor (disabled)
+    SpriteAtlas() = delete;
+
+    /// Copy constructor (disabled)
+    SpriteAtlas(const SpriteAtlas &) = delete;
+
+    /// Assignment operator
+    void operator=(const SpriteAtlas &) = delete;
+
+    static std::shared_ptr<SpriteAtlas> Get(const std::vector<std::wstring> &filenames);
+    static void Clear();
+
+    /**
+     * Get the number of frames in the atlas
+     * @return Number of frames
+     */
+    int GetFrameCount() const { return (int)mFrames.size(); }
+
+    void DrawFrame(const std::shared_ptr<wxGraphicsContext> &graphics, int frame,
+            double x, double y, double wid, double hit);
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_SPRITEATLAS_H
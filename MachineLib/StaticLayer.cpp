@@ -0,0 +1,148 @@
+/**
+ * @file StaticLayer.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <algorithm>
+#include <cfloat>
+#include "StaticLayer.h"
+#include "Component.h"
+#include "RenderContext.h"
+
+/// Largest layer width or height in pixels we will cache.
+/// Bigger layers are drawn directly instead.
+const int MaxLayerSize = 4096;
+
+/// Extra pixels around the layer so antialiased edges are kept
+const int LayerMargin = 1;
+
+/**
+ * Add a component whose static parts belong in this layer
+ * @param component Component to add
+ */
+void StaticLayer::Add(Component *component)
+{
+    auto bounds = component->GetStaticBounds();
+    if (mComponents.empty())
+    {
+        mBounds = bounds;
+    }
+    else
+    {
+        mBounds.Union(bounds);
+    }
+
+    mComponents.push_back(component);
+    mRendered = false;
+}
+
+/**
+ * Draw the layer, drawing it into the cache first if the
+ * current transform is not the one it was cached for
+ * @param graphics The graphics context object to draw on
+ */
+void StaticLayer::Draw(RenderContext &graphics)
+{
+    auto transform = graphics->GetTransform();
+
+    double m[6];
+    transform.Get(&m[0], &m[1], &m[2], &m[3], &m[4], &m[5]);
+    auto contentScale = graphics->GetContentScaleFactor();
+    if (!mRendered || !std::equal(m, m + 6, mTransform) || contentScale != mContentScale)
+    {
+        std::copy(m, m + 6, mTransform);
+        mContentScale = contentScale;
+        mCached = Render(graphics);
+        mRendered = true;
+    }
+
+    if (!mCached)
+    {
+        for (auto component : mComponents)
+        {
+            component->DrawStatic(graphics);
+        }
+
+        return;
+    }
+
+    // Undo the machine transform so the bitmap lands on whole pixels
+    graphics->PushState();
+    transform.Invert();
+    graphics->ConcatTransform(transform);
+    graphics->DrawBitmap(mBitmap, mDeviceRect.x, mDeviceRect.y, mDeviceRect.width, mDeviceRect.height);
+    graphics->PopState();
+}
+
+/**
+ * Draw the static parts into the cached bitmap for the transform in mTransform.
+ * The bitmap has mContentScale pixels for each unit of mDeviceRect, so it
+ * stays sharp on high DPI displays.
+ * @param graphics The graphics context the layer will be drawn on
+ * @return true if the bitmap was created
+ */
+bool StaticLayer::Render(RenderContext &graphics)
+{
+    if (mBounds.IsEmpty())
+    {
+        return false;
+    }
+
+    //
+    // Find the device pixels the static parts cover
+    //
+    auto &m = mTransform;
+    wxPoint2DDouble corners[] = {mBounds.GetLeftTop(), mBounds.GetRightTop(),
+                                 mBounds.GetLeftBottom(), mBounds.GetRightBottom()};
+
+    double left = DBL_MAX, top = DBL_MAX, right = -DBL_MAX, bottom = -DBL_MAX;
+    for (auto corner : corners)
+    {
+        double x = m[0] * corner.m_x + m[2] * corner.m_y + m[4];
+        double y = m[1] * corner.m_x + m[3] * corner.m_y + m[5];
+        left = std::min(left, x);
+        top = std::min(top, y);
+        right = std::max(right, x);
+        bottom = std::max(bottom, y);
+    }
+
+    mDeviceRect.x = (int)floor(left) - LayerMargin;
+    mDeviceRect.y = (int)floor(top) - LayerMargin;
+    mDeviceRect.width = (int)ceil(right) + LayerMargin - mDeviceRect.x;
+    mDeviceRect.height = (int)ceil(bottom) + LayerMargin - mDeviceRect.y;
+
+    int width = (int)ceil(mDeviceRect.width * mContentScale);
+    int height = (int)ceil(mDeviceRect.height * mContentScale);
+    if (width > MaxLayerSize || height > MaxLayerSize)
+    {
+        mBitmap = wxGraphicsBitmap();
+        return false;
+    }
+
+    //
+    // Draw the static parts into a transparent image
+    //
+    wxImage image(width, height);
+    image.InitAlpha();
+    memset(image.GetAlpha(), 0, (size_t)width * height);
+
+    {
+        RenderContext layerGraphics(std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create(image)));
+
+        layerGraphics->SetInterpolationQuality(graphics->GetInterpolationQuality());
+        layerGraphics->Scale(mContentScale, mContentScale);
+        layerGraphics->Translate(-mDeviceRect.x, -mDeviceRect.y);
+        layerGraphics->ConcatTransform(layerGraphics->CreateMatrix(m[0], m[1], m[2], m[3], m[4], m[5]));
+
+        for (auto component : mComponents)
+        {
+            component->DrawStatic(layerGraphics);
+        }
+
+        // The image is only updated when the context is destroyed
+    }
+
+    mBitmap = graphics->CreateBitmapFromImage(image);
+    return true;
+}
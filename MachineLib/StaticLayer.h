@@ -0,0 +1,69 @@
+/**
+ * @file StaticLayer.h
+ * @author Mate Narh
+ *
+ * Cached drawing of a run of machine parts that never move
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_STATICLAYER_H
+#define CANADIANEXPERIENCE_MACHINELIB_STATICLAYER_H
+
+class Component;
+class RenderContext;
+
+/**
+ * Cached drawing of a run of machine parts that never move.
+ *
+ * The static parts of consecutive components are drawn once
+ * into a bitmap at the resolution they appear on the screen.
+ * The bitmap is drawn back pixel for pixel until the transform
+ * it was drawn for (the machine scale and location) changes.
+ */
+class StaticLayer
+{
+private:
+    /// Components whose static parts are in this layer, in drawing order
+    std::vector<Component*> mComponents;
+
+    /// Bounds of the static parts in centimeters
+    wxRect2DDouble mBounds;
+
+    /// The cached drawing
+    wxGraphicsBitmap mBitmap;
+
+    /// Where the bitmap goes in the untransformed device space
+    wxRect mDeviceRect;
+
+    /// Transform the layer was drawn for (a, b, c, d, tx, ty)
+    double mTransform[6] = {0, 0, 0, 0, 0, 0};
+
+    /// Device pixels per unit of mDeviceRect the layer was drawn for
+    double mContentScale = 1;
+
+    /// Has the layer been drawn for mTransform and mContentScale?
+    bool mRendered = false;
+
+    /// Is mBitmap usable? False if the layer was too big to cache
+    bool mCached = false;
+
+    bool Render(RenderContext &graphics);
+
+public:
+    StaticLayer() {}
+
+    /// Copy constructor (disabled)
+    StaticLayer(const StaticLayer &) = delete;
+
+    /// Assignment operator
+    void operator=(const StaticLayer &) = delete;
+
+    void Add(Component *component);
+    void Draw(RenderContext &graphics);
+
+    /**
+     * Force the layer to be drawn again the next time it is used
+     */
+    void Invalidate() { mRendered = false; }
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_STATICLAYER_H
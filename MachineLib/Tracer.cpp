@@ -0,0 +1,173 @@
+/**
+ * @file Tracer.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <chrono>
+#include <sstream>
+#include <wx/ffile.h>
+#include "Tracer.h"
+
+std::atomic<bool> Tracer::mEnabled(false);
+std::vector<std::unique_ptr<Tracer::ThreadBuffer>> Tracer::mBuffers;
+std::mutex Tracer::mMutex;
+
+/// Number of events each thread can record. Events
+/// after this are counted but not kept.
+const size_t ThreadBufferEvents = 1 << 16;
+
+/**
+ * Enable or disable tracing
+ * @param enabled If true, zones are recorded
+ */
+void Tracer::SetEnabled(bool enabled)
+{
+    mEnabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * Get the current trace time
+ * @return Nanoseconds on a monotonic clock
+ */
+int64_t Tracer::Now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Get the buffer for the calling thread, creating it on first use
+ * @return Buffer only the calling thread writes to
+ */
+Tracer::ThreadBuffer *Tracer::GetThreadBuffer()
+{
+    thread_local ThreadBuffer *buffer = nullptr;
+    if (buffer == nullptr)
+    {
+        auto newBuffer = std::make_unique<ThreadBuffer>();
+        newBuffer->mEvents = std::make_unique<Event[]>(ThreadBufferEvents);
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        newBuffer->mThreadId = (int)mBuffers.size() + 1;
+        buffer = newBuffer.get();
+        mBuffers.push_back(std::move(newBuffer));
+    }
+
+    return buffer;
+}
+
+/**
+ * Record a completed zone for the calling thread
+ * @param name Zone name, must be a string literal
+ * @param start Start time from Now()
+ * @param end End time from Now()
+ */
+void Tracer::Record(const char *name, int64_t start, int64_t end)
+{
+    auto buffer = GetThreadBuffer();
+
+    size_t count = buffer->mCount.load(std::memory_order_relaxed);
+    if (count >= ThreadBufferEvents)
+    {
+        buffer->mDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    buffer->mEvents[count] = Event{name, start, end};
+
+    // Publish the event to readers
+    buffer->mCount.store(count + 1, std::memory_order_release);
+}
+
+/**
+ * Write the recorded events in the Chrome trace event format.
+ *
+ * Threads may keep recording while this runs, events
+ * recorded after it starts may be left out.
+ * @return JSON trace document
+ */
+std::string Tracer::ToJson()
+{
+    std::ostringstream json;
+    json.precision(3);
+    json << std::fixed << "{\"traceEvents\":[";
+
+    size_t dropped = 0;
+    bool first = true;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto &buffer : mBuffers)
+    {
+        size_t count = buffer->mCount.load(std::memory_order_acquire);
+        dropped += buffer->mDropped.load(std::memory_order_relaxed);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            auto &event = buffer->mEvents[i];
+
+            json << (first ? "\n" : ",\n");
+            first = false;
+
+            // Zone names are literals without quotes or
+            // backslashes, so they need no escaping
+            json << "{\"name\":\"" << event.mName << "\",\"ph\":\"X\",\"pid\":1"
+                << ",\"tid\":" << buffer->mThreadId
+                << ",\"ts\":" << event.mStart / 1000.0
+                << ",\"dur\":" << (event.mEnd - event.mStart) / 1000.0 << "}";
+        }
+    }
+
+    json << "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"droppedEvents\":\"" << dropped << "\"}}\n";
+    return json.str();
+}
+
+/**
+ * Save the recorded events to a file in the Chrome trace event format
+ * @param filename File to write
+ * @return true if the file was written
+ */
+bool Tracer::Save(const std::wstring &filename)
+{
+    auto json = ToJson();
+
+    wxFFile file(filename, L"w");
+    if (!file.IsOpened())
+    {
+        return false;
+    }
+
+    bool ok = file.Write(json.data(), json.size()) == json.size();
+    return file.Close() && ok;
+}
+
+/**
+ * Get the number of events lost because a thread's buffer was full
+ * @return Number of dropped events since the last Clear
+ */
+size_t Tracer::GetDropped()
+{
+    size_t dropped = 0;
+
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto &buffer : mBuffers)
+    {
+        dropped += buffer->mDropped.load(std::memory_order_relaxed);
+    }
+
+    return dropped;
+}
+
+/**
+ * Discard the recorded events. No other thread may
+ * be recording while this runs.
+ */
+void Tracer::Clear()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    for (auto &buffer : mBuffers)
+    {
+        buffer->mCount.store(0, std::memory_order_relaxed);
+        buffer->mDropped.store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,137 @@
+/**
+ * @file Tracer.h
+ * @author Mate Narh
+ *
+ * Opt-in recording of timed zones, saved in the Chrome trace event format.
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_TRACER_H
+#define CANADIANEXPERIENCE_MACHINELIB_TRACER_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * Opt-in recording of timed zones, saved in the Chrome trace event format.
+ *
+ * Zones are marked with TRACE_ZONE. Each thread records into its
+ * own fixed size buffer without locking, so recording does not
+ * make threads wait on each other. When tracing is disabled a
+ * zone costs one relaxed atomic load, so the zones stay in
+ * release builds. Save writes the events as JSON that can be
+ * opened in chrome://tracing or Perfetto.
+ */
+class Tracer {
+private:
+    /// One completed zone
+    struct Event
+    {
+        /// Zone name, must be a string literal
+        const char *mName;
+
+        /// Start time in nanoseconds
+        int64_t mStart;
+
+        /// End time in nanoseconds
+        int64_t mEnd;
+    };
+
+    /// The events recorded by one thread
+    struct ThreadBuffer
+    {
+        /// Thread id written to the trace
+        int mThreadId = 0;
+
+        /// Event storage
+        std::unique_ptr<Event[]> mEvents;
+
+        /// Number of events written. Only the owning thread
+        /// changes this, after the event itself is written.
+        std::atomic<size_t> mCount{0};
+
+        /// Number of events lost because the buffer was full
+        std::atomic<size_t> mDropped{0};
+    };
+
+    /// Is tracing enabled?
+    static std::atomic<bool> mEnabled;
+
+    /// Buffers for every thread that has recorded an event. Buffers
+    /// live until the program ends, so threads can exit at any time.
+    static std::vector<std::unique_ptr<ThreadBuffer>> mBuffers;
+
+    /// Protects mBuffers. Only taken when a thread records
+    /// its first event and when the trace is saved.
+    static std::mutex mMutex;
+
+    static ThreadBuffer *GetThreadBuffer();
+
+public:
+    /// Constructor (disabled)
+    Tracer() = delete;
+
+    /**
+     * Is tracing enabled?
+     * @return true if zones are being recorded
+     */
+    static bool IsEnabled() { return mEnabled.load(std::memory_order_relaxed); }
+
+    static void SetEnabled(bool enabled);
+    static int64_t Now();
+    static void Record(const char *name, int64_t start, int64_t end);
+    static std::string ToJson();
+    static bool Save(const std::wstring &filename);
+    static size_t GetDropped();
+    static void Clear();
+};
+
+/**
+ * Records the time from construction to destruction as a
+ * trace zone if tracing was enabled when it was constructed.
+ */
+class TraceZone {
+private:
+    /// Zone name, must be a string literal
+    const char *mName;
+
+    /// Start time in nanoseconds, negative if not recording
+    int64_t mStart;
+
+public:
+    /**
+     * Constructor
+     * @param name Zone name, must be a string literal
+     */
+    explicit TraceZone(const char *name) :
+        mName(name), mStart(Tracer::IsEnabled() ? Tracer::Now() : -1) {}
+
+    /// Destructor
+    ~TraceZone()
+    {
+        if (mStart >= 0)
+        {
+            Tracer::Record(mName, mStart, Tracer::Now());
+        }
+    }
+
+    /// Copy constructor (disabled)
+    TraceZone(const TraceZone &) = delete;
+
+    /// Assignment operator
+    void operator=(const TraceZone &) = delete;
+};
+
+/// Join two tokens after expanding them
+#define TRACE_ZONE_CONCAT(a, b) a##b
+
+/// Name for a zone variable that is unique within its scope
+#define TRACE_ZONE_VARIABLE(line) TRACE_ZONE_CONCAT(traceZone, line)
+
+/// Trace the rest of the enclosing scope as a zone with a literal name
+#define TRACE_ZONE(name) TraceZone TRACE_ZONE_VARIABLE(__LINE__)(name)
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_TRACER_H
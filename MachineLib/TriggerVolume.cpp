@@ -0,0 +1,94 @@
+/**
+ * @file TriggerVolume.cpp
+ * @author Mate Narh
+ */
+
+#include "pch.h"
+#include <algorithm>
+#include <b2_contact.h>
+#include <b2_fixture.h>
+#include "TriggerVolume.h"
+
+/**
+ * Constructor
+ */
+TriggerVolume::TriggerVolume()
+{
+    SetSensor();
+}
+
+/**
+ * Get the body in a contact that is not this volume
+ * @param contact Contact with this volume
+ * @return The other body
+ */
+b2Body *TriggerVolume::GetOther(b2Contact *contact)
+{
+    auto body = contact->GetFixtureA()->GetBody();
+    return body == GetBody() ? contact->GetFixtureB()->GetBody() : body;
+}
+
+/**
+ * Queue a body entering the volume
+ * @param contact Contact object
+ */
+void TriggerVolume::BeginContact(b2Contact *contact)
+{
+    mEvents.emplace_back(GetOther(contact), true);
+}
+
+/**
+ * Queue a body leaving the volume
+ * @param contact Contact object
+ */
+void TriggerVolume::EndContact(b2Contact *contact)
+{
+    mEvents.emplace_back(GetOther(contact), false);
+}
+
+/**
+ * Hand the bodies that entered and left during the
+ * last step to the owner, in the order they did so.
+ * Called after the step.
+ */
+void TriggerVolume::Drain()
+{
+    // Indexed, since a handler that destroys a body
+    // can queue another event while we are here
+    for (size_t i = 0; i < mEvents.size(); i++)
+    {
+        auto body = mEvents[i].first;
+        if (mEvents[i].second)
+        {
+            mInside.push_back(body);
+            if (mOnEnter)
+            {
+                mOnEnter(body);
+            }
+        }
+        else
+        {
+            auto found = std::find(mInside.begin(), mInside.end(), body);
+            if (found != mInside.end())
+            {
+                mInside.erase(found);
+            }
+
+            if (mOnExit)
+            {
+                mOnExit(body);
+            }
+        }
+    }
+
+    mEvents.clear();
+}
+
+/**
+ * Forget every body, for when the machine is reset
+ */
+void TriggerVolume::Reset()
+{
+    mEvents.clear();
+    mInside.clear();
+}
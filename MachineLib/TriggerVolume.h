@@ -0,0 +1,76 @@
+/**
+ * @file TriggerVolume.h
+ * @author Mate Narh
+ *
+ * An area of a machine that reports bodies entering and leaving it
+ */
+
+#ifndef CANADIANEXPERIENCE_MACHINELIB_TRIGGERVOLUME_H
+#define CANADIANEXPERIENCE_MACHINELIB_TRIGGERVOLUME_H
+
+#include <functional>
+#include <b2_world_callbacks.h>
+#include "PhysicsPolygon.h"
+
+/**
+ * An area of a machine that reports bodies entering and leaving it.
+ *
+ * The area is a Box2D sensor, so bodies pass through it and it
+ * never goes through the contact solver. Box2D reports sensor
+ * contacts in the middle of a step, when the world can't be
+ * changed, so they are queued and handed to the owner by Drain
+ * after the step. The machine's ContactListener calls Drain for
+ * every trigger added to it.
+ */
+class TriggerVolume : public cse335::PhysicsPolygon, public b2ContactListener
+{
+private:
+    /// Bodies that entered (true) or left (false) during the
+    /// last step, in the order Box2D reported them
+    std::vector<std::pair<b2Body *, bool>> mEvents;
+
+    /// Bodies inside the volume as of the last Drain
+    std::vector<b2Body *> mInside;
+
+    /// Called with each body that enters
+    std::function<void(b2Body *)> mOnEnter;
+
+    /// Called with each body that leaves
+    std::function<void(b2Body *)> mOnExit;
+
+    b2Body *GetOther(b2Contact *contact);
+
+public:
+    TriggerVolume();
+
+    /// Copy constructor (disabled)
+    TriggerVolume(const TriggerVolume &) = delete;
+
+    /// Assignment operator
+    void operator=(const TriggerVolume &) = delete;
+
+    void BeginContact(b2Contact *contact) override;
+    void EndContact(b2Contact *contact) override;
+    void Drain();
+    void Reset();
+
+    /**
+     * Set what to do when a body enters the volume
+     * @param onEnter Function called after the step with the body
+     */
+    void SetOnEnter(std::function<void(b2Body *)> onEnter) { mOnEnter = onEnter; }
+
+    /**
+     * Set what to do when a body leaves the volume
+     * @param onExit Function called after the step with the body
+     */
+    void SetOnExit(std::function<void(b2Body *)> onExit) { mOnExit = onExit; }
+
+    /**
+     * Get the bodies inside the volume
+     * @return Bodies in the order they entered
+     */
+    const std::vector<b2Body *> &GetInside() const { return mInside; }
+};
+
+#endif //CANADIANEXPERIENCE_MACHINELIB_TRIGGERVOLUME_H
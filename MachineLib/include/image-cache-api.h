@@ -0,0 +1,14 @@
+/**
+ * @file image-cache-api.h
+ * @author Mate Narh
+ *
+ * Header for the image cache shared by the machines
+ * library and the application.
+ */
+
+#ifndef MACHINELIB_IMAGE_CACHE_API_H
+#define MACHINELIB_IMAGE_CACHE_API_H
+
+#include "../ImageCache.h"
+
+#endif //MACHINELIB_IMAGE_CACHE_API_H
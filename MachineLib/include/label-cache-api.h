@@ -0,0 +1,14 @@
+/**
+ * @file label-cache-api.h
+ * @author Mate Narh
+ *
+ * Header for the text label cache shared by the machines
+ * library and the application.
+ */
+
+#ifndef MACHINELIB_LABEL_CACHE_API_H
+#define MACHINELIB_LABEL_CACHE_API_H
+
+#include "../LabelCache.h"
+
+#endif //MACHINELIB_LABEL_CACHE_API_H
@@ -0,0 +1,14 @@
+/**
+ * @file machine-images-api.h
+ * @author Mate Narh
+ *
+ * Header for the list of images the machines load, so the
+ * application can preload them with its own.
+ */
+
+#ifndef MACHINELIB_MACHINE_IMAGES_API_H
+#define MACHINELIB_MACHINE_IMAGES_API_H
+
+#include "../MachineImages.h"
+
+#endif //MACHINELIB_MACHINE_IMAGES_API_H
@@ -0,0 +1,14 @@
+/**
+ * @file machine-system-api.h
+ * @author Mate Narh
+ *
+ * Header for the concrete machine system, so the application
+ * can name the metrics of the machines it creates.
+ */
+
+#ifndef MACHINELIB_MACHINE_SYSTEM_API_H
+#define MACHINELIB_MACHINE_SYSTEM_API_H
+
+#include "../MachineSystem.h"
+
+#endif //MACHINELIB_MACHINE_SYSTEM_API_H
@@ -0,0 +1,14 @@
+/**
+ * @file metrics-api.h
+ * @author Mate Narh
+ *
+ * Header for the performance metrics shared by the
+ * machines library and the application.
+ */
+
+#ifndef MACHINELIB_METRICS_API_H
+#define MACHINELIB_METRICS_API_H
+
+#include "../Metrics.h"
+
+#endif //MACHINELIB_METRICS_API_H
@@ -0,0 +1,14 @@
+/**
+ * @file render-api.h
+ * @author Mate Narh
+ *
+ * Header for the render context shared by the machines
+ * library and the application.
+ */
+
+#ifndef MACHINELIB_RENDER_API_H
+#define MACHINELIB_RENDER_API_H
+
+#include "../RenderContext.h"
+
+#endif //MACHINELIB_RENDER_API_H
@@ -0,0 +1,14 @@
+/**
+ * @file sprite-atlas-api.h
+ * @author Mate Narh
+ *
+ * Header for the sprite atlas cache, so the application
+ * can release it at shutdown.
+ */
+
+#ifndef MACHINELIB_SPRITE_ATLAS_API_H
+#define MACHINELIB_SPRITE_ATLAS_API_H
+
+#include "../SpriteAtlas.h"
+
+#endif //MACHINELIB_SPRITE_ATLAS_API_H
@@ -0,0 +1,14 @@
+/**
+ * @file trace-api.h
+ * @author Mate Narh
+ *
+ * Header for tracing shared by the machines
+ * library and the application.
+ */
+
+#ifndef MACHINELIB_TRACE_API_H
+#define MACHINELIB_TRACE_API_H
+
+#include "../Tracer.h"
+
+#endif //MACHINELIB_TRACE_API_H
@@ -0,0 +1,64 @@
+/**
+ * @file ConveyorTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <b2_world.h>
+#include <b2_body.h>
+#include <Machine.h>
+#include <Conveyor.h>
+
+TEST(ConveyorTest, Riders)
+{
+    Machine machine(1);
+    auto conveyor = std::make_shared<Conveyor>(L"./images");
+    conveyor->SetPosition(0, 0);
+    machine.AddComponent(conveyor);
+    machine.Reset();
+
+    auto world = machine.GetWorld();
+    const double Elapsed = 1.0 / 30;
+
+    // The belt is turning before anything lands on it
+    conveyor->Rotate(0, 2);
+
+    // A box dropped from above lands on the belt
+    cse335::PhysicsPolygon box;
+    box.BottomCenteredRectangle(10, 10);
+    box.SetInitialPosition(0, 40);
+    box.SetPhysics(1.0, 0.5, 0);
+    box.SetDynamic();
+    box.InstallPhysics(world);
+    ASSERT_EQ(0, conveyor->GetNumRiders());
+
+    int steps = 0;
+    while (conveyor->GetNumRiders() == 0 && steps < 120)
+    {
+        world->Step(Elapsed, 8, 3);
+        steps++;
+    }
+    ASSERT_EQ(1, conveyor->GetNumRiders());
+
+    // The update after landing sets it moving with the belt
+    conveyor->Update(Elapsed);
+    ASSERT_FLOAT_EQ(-2, box.GetBody()->GetLinearVelocity().x);
+    ASSERT_FLOAT_EQ(0, box.GetBody()->GetLinearVelocity().y);
+
+    // It stays on while the belt carries it
+    world->Step(Elapsed, 8, 3);
+    conveyor->Update(Elapsed);
+    ASSERT_EQ(1, conveyor->GetNumRiders());
+
+    // A new speed is applied to the bodies already riding
+    conveyor->Rotate(0, 3);
+    conveyor->Update(Elapsed);
+    ASSERT_FLOAT_EQ(-3, box.GetBody()->GetLinearVelocity().x);
+
+    // Lifted off the belt, it is no longer riding
+    box.GetBody()->SetTransform(b2Vec2(0, 5), 0);
+    world->Step(Elapsed, 8, 3);
+    ASSERT_EQ(0, conveyor->GetNumRiders());
+}
@@ -0,0 +1,48 @@
+/**
+ * @file DrivetrainTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Drivetrain.h>
+#include <Pulley.h>
+
+TEST(DrivetrainTest, Order)
+{
+    auto pulley1 = std::make_shared<Pulley>(10);
+    auto pulley2 = std::make_shared<Pulley>(20);
+    auto pulley3 = std::make_shared<Pulley>(5);
+    auto pulley4 = std::make_shared<Pulley>(10);
+
+    // Pulley 1 drives pulleys 2 and 4, pulley 2 drives pulley 3
+    pulley1->Drive(pulley2);
+    pulley2->Drive(pulley3);
+    pulley1->GetSource()->AddSink(pulley4);
+
+    // Added in the reverse of the order they turn
+    std::vector<std::shared_ptr<Component>> components = {pulley3, pulley4, pulley2, pulley1};
+
+    Drivetrain drivetrain;
+    drivetrain.Build(components);
+    ASSERT_EQ(3, drivetrain.GetNumLinks());
+    ASSERT_EQ(0, drivetrain.GetNumLooped());
+
+    // Nothing is driving yet
+    drivetrain.Rotate();
+    ASSERT_EQ(0, pulley3->GetRotation());
+
+    // One pass carries the rotation down the whole chain
+    pulley1->Rotate(1, 2);
+    drivetrain.Rotate();
+    ASSERT_NEAR(0.5, pulley2->GetRotation(), 0.0001);
+    ASSERT_NEAR(2, pulley3->GetRotation(), 0.0001);
+    ASSERT_NEAR(1, pulley4->GetRotation(), 0.0001);
+
+    // A loop is still turned, after everything else
+    pulley3->GetSource()->AddSink(pulley1);
+    drivetrain.Build(components);
+    ASSERT_EQ(4, drivetrain.GetNumLinks());
+    ASSERT_EQ(4, drivetrain.GetNumLooped());
+}
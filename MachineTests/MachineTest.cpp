@@ -8,6 +8,7 @@
 
 #include <MachineSystemFactory.h>
 #include <IMachineSystem.h>
+#include <MachineSystem.h>
 
 TEST(MachineTest, Constructor)
 {
@@ -61,4 +62,40 @@ TEST(MachineTest, MachineNumber)
     // Ensure we can go back to machine number 1
     machine->SetMachineNumber(1);
     ASSERT_EQ(1, machine->GetMachineNumber());
-}
\ No newline at end of file
+}
+
+TEST(MachineTest, ComponentStats)
+{
+    MachineSystem system(L".");
+    system.SetMachineFrame(30);
+
+    auto stats = system.GetComponentStats();
+    ASSERT_FALSE(stats.empty());
+
+    int bodies = 0;
+    for (auto &entry : stats)
+    {
+        ASSERT_FALSE(entry.mType.empty());
+        if (entry.mType == L"Hamster" || entry.mType == L"Conveyor" || entry.mType == L"Basket")
+        {
+            // Types with an update pool get one update per frame stepped
+            ASSERT_EQ(30, entry.mUpdates);
+        }
+        else
+        {
+            // Pulleys are turned by the drivetrain, the rest only by physics
+            ASSERT_EQ(0, entry.mUpdates);
+        }
+
+        bodies += entry.mBodies;
+    }
+
+    ASSERT_EQ(system.GetBodyCount(), bodies);
+
+    system.ClearComponentStats();
+    for (auto &entry : system.GetComponentStats())
+    {
+        ASSERT_EQ(0, entry.mUpdates);
+        ASSERT_EQ(0, entry.mContacts);
+    }
+}
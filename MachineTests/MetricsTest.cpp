@@ -0,0 +1,72 @@
+/**
+ * @file MetricsTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <Metrics.h>
+
+TEST(MetricsTest, Handles)
+{
+    auto metric = Metrics::Get(L"test/handles", L"steps");
+    ASSERT_EQ(metric, Metrics::Get(L"test/handles"));
+    ASSERT_EQ(L"steps", metric->GetUnit());
+
+    Metrics::Get(L"test/other");
+    auto found = Metrics::Find(L"test/");
+    ASSERT_EQ(2u, found.size());
+    ASSERT_EQ(L"test/handles", found[0]->GetName());
+    ASSERT_EQ(L"test/other", found[1]->GetName());
+}
+
+TEST(MetricsTest, Remove)
+{
+    Metrics::Get(L"remove/1/a");
+    Metrics::Get(L"remove/1/b");
+    Metrics::Get(L"remove/2/a");
+
+    Metrics::Remove(L"remove/1/");
+    auto found = Metrics::Find(L"remove/");
+    ASSERT_EQ(1u, found.size());
+    ASSERT_EQ(L"remove/2/a", found[0]->GetName());
+}
+
+TEST(MetricsTest, History)
+{
+    Metric metric(L"history", L"ms");
+    ASSERT_EQ(0, metric.GetNumSamples());
+    ASSERT_EQ(0, metric.GetLast());
+
+    for (int i = 1; i <= Metric::HistorySize + 10; i++)
+    {
+        metric.Record(i);
+    }
+
+    // Only the newest values are kept, oldest first
+    ASSERT_EQ(Metric::HistorySize, metric.GetNumSamples());
+    ASSERT_EQ(11, metric.GetSample(0));
+    ASSERT_EQ(Metric::HistorySize + 10, metric.GetSample(Metric::HistorySize - 1));
+    ASSERT_EQ(Metric::HistorySize + 10, metric.GetLast());
+    ASSERT_EQ(Metric::HistorySize + 10, metric.GetMax());
+    ASSERT_DOUBLE_EQ(10.5 + Metric::HistorySize / 2.0, metric.GetAverage());
+}
+
+TEST(MetricsTest, UniquePrefix)
+{
+    auto first = Metrics::UniquePrefix(L"unique/Harold");
+    ASSERT_EQ(L"unique/Harold/", first);
+    Metrics::Get(first + L"draw");
+
+    // A second owner with the same name gets its own prefix
+    auto second = Metrics::UniquePrefix(L"unique/Harold");
+    ASSERT_EQ(L"unique/Harold #2/", second);
+    Metrics::Get(second + L"draw");
+
+    // Removing one group leaves the other
+    Metrics::Remove(first);
+    auto found = Metrics::Find(L"unique/");
+    ASSERT_EQ(1u, found.size());
+    ASSERT_EQ(L"unique/Harold #2/draw", found[0]->GetName());
+}
@@ -0,0 +1,99 @@
+/**
+ * @file PolygonTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+#include <wx/filefn.h>
+
+#include <Polygon.h>
+
+/**
+ * Average luminance of a block computed one pixel at a
+ * time, the way Polygon did before the summed area table
+ * @param image Image to average
+ * @param x Left of the block
+ * @param y Top of the block
+ * @param wid Block width
+ * @param hit Block height
+ * @return Average of red, green and blue over the block in the image, 0 to 1
+ */
+static double BruteForceLuminance(const wxImage &image, int x, int y, int wid, int hit)
+{
+    double sum = 0;
+    int cnt = 0;
+
+    for (int i = x; i < x + wid; i++)
+    {
+        for (int j = y; j < y + hit; j++)
+        {
+            if (i < 0 || i >= image.GetWidth() || j < 0 || j >= image.GetHeight())
+            {
+                continue;
+            }
+
+            sum += image.GetRed(i, j) + image.GetGreen(i, j) + image.GetBlue(i, j);
+            cnt += 3;
+        }
+    }
+
+    return cnt == 0 ? 0 : (sum / cnt) / 255.0;
+}
+
+TEST(PolygonTest, AverageLuminance)
+{
+    // An image with odd dimensions and no two pixels alike
+    const int ImageWid = 13;
+    const int ImageHit = 9;
+    wxImage image(ImageWid, ImageHit);
+    for (int i = 0; i < ImageWid; i++)
+    {
+        for (int j = 0; j < ImageHit; j++)
+        {
+            image.SetRGB(i, j, (i * 37 + j * 11) % 256, (i * 5 + j * 53) % 256, (i * j * 7 + 3) % 256);
+        }
+    }
+
+    const wxString filename = L"polygon-luminance-test.png";
+    ASSERT_TRUE(image.SaveFile(filename, wxBITMAP_TYPE_PNG));
+
+    cse335::Polygon polygon;
+    polygon.SetImage(filename.ToStdWstring());
+    wxRemoveFile(filename);
+
+    // Interior blocks
+    ASSERT_NEAR(BruteForceLuminance(image, 2, 3, 5, 3), polygon.AverageLuminance(2, 3, 5, 3), 1e-12);
+    ASSERT_NEAR(BruteForceLuminance(image, 6, 4, 1, 1), polygon.AverageLuminance(6, 4, 1, 1), 1e-12);
+    ASSERT_NEAR(BruteForceLuminance(image, 0, 0, ImageWid, ImageHit),
+            polygon.AverageLuminance(0, 0, ImageWid, ImageHit), 1e-12);
+
+    // Blocks clipped by each edge
+    ASSERT_NEAR(BruteForceLuminance(image, -3, 2, 7, 5), polygon.AverageLuminance(-3, 2, 7, 5), 1e-12);
+    ASSERT_NEAR(BruteForceLuminance(image, 4, -2, 3, 5), polygon.AverageLuminance(4, -2, 3, 5), 1e-12);
+    ASSERT_NEAR(BruteForceLuminance(image, 10, 6, 7, 5), polygon.AverageLuminance(10, 6, 7, 5), 1e-12);
+    ASSERT_NEAR(BruteForceLuminance(image, -5, -5, 30, 30), polygon.AverageLuminance(-5, -5, 30, 30), 1e-12);
+
+    // Blocks entirely outside the image
+    ASSERT_EQ(0, polygon.AverageLuminance(-10, 0, 5, 5));
+    ASSERT_EQ(0, polygon.AverageLuminance(ImageWid, 0, 3, 3));
+    ASSERT_EQ(0, polygon.AverageLuminance(0, ImageHit, 3, 3));
+    ASSERT_EQ(0, polygon.AverageLuminance(20, 20, 4, 4));
+
+    // Every block position for a range of odd and even sizes
+    for (int wid : {1, 2, 3, 5, 7, 13})
+    {
+        for (int hit : {1, 3, 4, 9})
+        {
+            for (int x = -wid; x <= ImageWid; x++)
+            {
+                for (int y = -hit; y <= ImageHit; y++)
+                {
+                    ASSERT_NEAR(BruteForceLuminance(image, x, y, wid, hit),
+                            polygon.AverageLuminance(x, y, wid, hit), 1e-12)
+                            << "Block " << x << ", " << y << ", " << wid << ", " << hit;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file TracerTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <thread>
+#include <Tracer.h>
+
+TEST(TracerTest, Disabled)
+{
+    Tracer::Clear();
+    Tracer::SetEnabled(false);
+
+    {
+        TRACE_ZONE("TracerTest::Disabled");
+    }
+
+    ASSERT_EQ(std::string::npos, Tracer::ToJson().find("TracerTest::Disabled"));
+}
+
+TEST(TracerTest, Zones)
+{
+    Tracer::Clear();
+    Tracer::SetEnabled(true);
+
+    {
+        TRACE_ZONE("TracerTest::Outer");
+        TRACE_ZONE("TracerTest::Inner");
+    }
+
+    // Zones on another thread go to that thread's buffer
+    std::thread thread([]() { TRACE_ZONE("TracerTest::Thread"); });
+    thread.join();
+
+    Tracer::SetEnabled(false);
+
+    auto json = Tracer::ToJson();
+    ASSERT_EQ(0u, json.find("{\"traceEvents\":["));
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"TracerTest::Outer\",\"ph\":\"X\""));
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"TracerTest::Inner\""));
+    ASSERT_NE(std::string::npos, json.find("\"name\":\"TracerTest::Thread\""));
+}
+
+TEST(TracerTest, Dropped)
+{
+    Tracer::Clear();
+    ASSERT_EQ(0u, Tracer::GetDropped());
+
+    // Fill this thread's buffer and go past it
+    const size_t BufferEvents = 1 << 16;
+    for (size_t i = 0; i < BufferEvents + 5; i++)
+    {
+        Tracer::Record("TracerTest::Dropped", 0, 1);
+    }
+    ASSERT_EQ(5u, Tracer::GetDropped());
+
+    Tracer::Clear();
+    ASSERT_EQ(0u, Tracer::GetDropped());
+}
@@ -0,0 +1,101 @@
+/**
+ * @file TriggerVolumeTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <b2_world.h>
+#include <b2_contact.h>
+#include <TriggerVolume.h>
+#include <ContactListener.h>
+
+TEST(TriggerVolumeTest, EnterExit)
+{
+    auto world = std::make_shared<b2World>(b2Vec2(0.0f, -9.8f));
+    ContactListener listener;
+    world->SetContactListener(&listener);
+
+    TriggerVolume trigger;
+    trigger.BottomCenteredRectangle(wxSize(40, 10));
+    trigger.SetInitialPosition(0, 0);
+    trigger.InstallPhysics(world);
+    listener.AddTrigger(&trigger);
+
+    int entered = 0;
+    int exited = 0;
+    trigger.SetOnEnter([&](b2Body *body) { entered++; });
+    trigger.SetOnExit([&](b2Body *body) { exited++; });
+
+    // A ball dropped from above falls straight through
+    cse335::PhysicsPolygon ball;
+    ball.Circle(2);
+    ball.SetInitialPosition(0, 30);
+    ball.SetDynamic();
+    ball.InstallPhysics(world);
+
+    bool wasInside = false;
+    for (int i = 0; i < 120; i++)
+    {
+        world->Step(1.0f / 60, 6, 2);
+        listener.DrainTriggers();
+        if (trigger.GetInside().size() == 1)
+        {
+            wasInside = true;
+            ASSERT_EQ(ball.GetBody(), trigger.GetInside()[0]);
+        }
+    }
+
+    ASSERT_TRUE(wasInside);
+    ASSERT_EQ(1, entered);
+    ASSERT_EQ(1, exited);
+    ASSERT_TRUE(trigger.GetInside().empty());
+    ASSERT_LT(ball.GetPosition().m_y, 0);
+}
+
+TEST(TriggerVolumeTest, ExitAndEnterInOneStep)
+{
+    auto world = std::make_shared<b2World>(b2Vec2(0.0f, 0.0f));
+    ContactListener listener;
+    world->SetContactListener(&listener);
+
+    TriggerVolume trigger;
+    trigger.BottomCenteredRectangle(wxSize(40, 10));
+    trigger.SetInitialPosition(0, 0);
+    trigger.InstallPhysics(world);
+    listener.AddTrigger(&trigger);
+
+    std::vector<std::pair<b2Body *, bool>> events;
+    trigger.SetOnEnter([&](b2Body *body) { events.emplace_back(body, true); });
+    trigger.SetOnExit([&](b2Body *body) { events.emplace_back(body, false); });
+
+    // A ball at rest inside the volume
+    cse335::PhysicsPolygon ball;
+    ball.Circle(2);
+    ball.SetInitialPosition(0, 5);
+    ball.SetDynamic();
+    ball.InstallPhysics(world);
+
+    world->Step(1.0f / 60, 6, 2);
+    listener.DrainTriggers();
+    ASSERT_EQ(1u, trigger.GetInside().size());
+    events.clear();
+
+    // Box2D reports the ball leaving and coming back
+    // in the same step, before the trigger is drained
+    auto contact = world->GetContactList();
+    ASSERT_NE(nullptr, contact);
+    trigger.EndContact(contact);
+    trigger.BeginContact(contact);
+    listener.DrainTriggers();
+
+    // The owner hears about them in that order and the ball is still inside
+    ASSERT_EQ(2u, events.size());
+    ASSERT_EQ(ball.GetBody(), events[0].first);
+    ASSERT_FALSE(events[0].second);
+    ASSERT_EQ(ball.GetBody(), events[1].first);
+    ASSERT_TRUE(events[1].second);
+    ASSERT_EQ(1u, trigger.GetInside().size());
+    ASSERT_EQ(ball.GetBody(), trigger.GetInside()[0]);
+}
@@ -9,6 +9,7 @@
 #include <Actor.h>
 #include <PolyDrawable.h>
 #include <Picture.h>
+#include <metrics-api.h>
 
 TEST(ActorTest, Constructor)
 {
@@ -151,4 +152,16 @@ TEST(ActorTest, Animation)
     picture->SetAnimationTime(2.0);    // 1/3 between the two keyframes
     ASSERT_EQ((int)(101 + 1.0 / 3.0 * (202 - 101)), actor->GetPosition().x);
     ASSERT_EQ((int)(655 + 1.0 / 3.0 * (1000 - 655)), actor->GetPosition().y);
-}
\ No newline at end of file
+}
+TEST(ActorTest, Metrics)
+{
+    {
+        // Actors with the same name get separate metrics
+        Actor harold1(L"MetricsHarold");
+        Actor harold2(L"MetricsHarold");
+        ASSERT_EQ(2u, Metrics::Find(L"actor/MetricsHarold").size());
+    }
+
+    // Destroyed actors remove their metrics
+    ASSERT_TRUE(Metrics::Find(L"actor/MetricsHarold").empty());
+}
@@ -0,0 +1,113 @@
+/**
+ * @file AllocationCounter.cpp
+ * @author Mate Narh
+ *
+ * Replaces the global operator new and delete for the test
+ * program so allocations can be counted.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "AllocationCounter.h"
+
+/// Number of allocations made through operator new
+static std::atomic<long> allocations(0);
+
+/// Number of bytes allocated through operator new
+static std::atomic<size_t> allocatedBytes(0);
+
+/**
+ * Allocate memory and count the allocation
+ * @param size Number of bytes
+ * @return Memory or nullptr if out of memory
+ */
+static void *CountedAlloc(size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new(size_t size)
+{
+    void *memory = CountedAlloc(size);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    return memory;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept
+{
+    return CountedAlloc(size);
+}
+
+void operator delete(void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept
+{
+    std::free(memory);
+}
+
+/**
+ * Constructor, counting starts now
+ */
+AllocationCounter::AllocationCounter() :
+    mStartAllocations(allocations.load(std::memory_order_relaxed)),
+    mStartBytes(allocatedBytes.load(std::memory_order_relaxed))
+{
+}
+
+/**
+ * Get the number of allocations since this counter was created
+ * @return Number of allocations
+ */
+long AllocationCounter::GetAllocations() const
+{
+    return allocations.load(std::memory_order_relaxed) - mStartAllocations;
+}
+
+/**
+ * Get the number of bytes allocated since this counter was created
+ * @return Number of bytes
+ */
+size_t AllocationCounter::GetBytes() const
+{
+    return allocatedBytes.load(std::memory_order_relaxed) - mStartBytes;
+}
@@ -0,0 +1,43 @@
+/**
+ * @file AllocationCounter.h
+ * @author Mate Narh
+ *
+ * Counts heap allocations made through operator new in the tests.
+ */
+
+#ifndef CANADIANEXPERIENCE_ALLOCATIONCOUNTER_H
+#define CANADIANEXPERIENCE_ALLOCATIONCOUNTER_H
+
+#include <cstddef>
+
+/**
+ * Counts heap allocations made through operator new in the tests.
+ *
+ * AllocationCounter.cpp replaces the global operator new and
+ * delete for the test program only, so the counts include every
+ * C++ allocation from any thread. Allocations libraries make
+ * with malloc directly, such as inside Box2D or the platform
+ * graphics, are not counted.
+ */
+class AllocationCounter {
+private:
+    /// Allocations when this counter was created
+    long mStartAllocations;
+
+    /// Bytes allocated when this counter was created
+    size_t mStartBytes;
+
+public:
+    AllocationCounter();
+
+    /// Copy constructor (disabled)
+    AllocationCounter(const AllocationCounter &) = delete;
+
+    /// Assignment operator
+    void operator=(const AllocationCounter &) = delete;
+
+    long GetAllocations() const;
+    size_t GetBytes() const;
+};
+
+#endif //CANADIANEXPERIENCE_ALLOCATIONCOUNTER_H
@@ -0,0 +1,137 @@
+/**
+ * @file AllocationTest.cpp
+ * @author Mate Narh
+ *
+ * Allocation budgets for the code that runs every frame.
+ *
+ * The budgets are advisory. They were measured with the graphics
+ * and physics backends stubbed out, so a run over budget is
+ * reported but only fails when ENFORCE_ALLOCATION_BUDGETS is set
+ * in the environment, as it should be once the budgets are
+ * measured on the real wxWidgets backend on each platform.
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <cstdlib>
+#include <iostream>
+
+#include <machine-api.h>
+#include <Picture.h>
+#include <Actor.h>
+#include <PolyDrawable.h>
+#include "AllocationCounter.h"
+
+/// Allocations allowed for drawing one polygon drawable. A warm
+/// draw measured 0, since the brush comes from the RenderContext
+/// pool and the path is cached. The 1 left over is for a graphics
+/// backend that grows its saved state stack on PushState.
+const long PolyDrawableBudget = 1;
+
+/// Allocations allowed for each machine frame simulated. A frame
+/// with no new contacts measured 0. The margin of 2 covers the
+/// map node and vector growth when a body first lands on a
+/// conveyor or enters a trigger volume.
+const long MachineFrameBudget = 2;
+
+/**
+ * Fixture for tests that hold code to an allocation budget
+ */
+class AllocationTest : public ::testing::Test
+{
+protected:
+    /**
+     * Count the allocations a function makes when it runs a
+     * second time, after any caches it fills are built
+     * @param function Function to count
+     * @return Number of allocations
+     */
+    template <class Function>
+    long CountAllocations(Function function)
+    {
+        function();
+
+        AllocationCounter counter;
+        function();
+        return counter.GetAllocations();
+    }
+
+    /**
+     * Check a count of allocations against its budget. Only
+     * fails when ENFORCE_ALLOCATION_BUDGETS is set
+     * @param allocations Number of allocations counted
+     * @param budget Number of allocations allowed
+     */
+    void CheckBudget(long allocations, long budget)
+    {
+        RecordProperty("Allocations", (int)allocations);
+        RecordProperty("Budget", (int)budget);
+
+        if (std::getenv("ENFORCE_ALLOCATION_BUDGETS") != nullptr)
+        {
+            ASSERT_LE(allocations, budget);
+        }
+        else if (allocations > budget)
+        {
+            std::cerr << "Advisory: " << allocations << " allocations, budget "
+                      << budget << std::endl;
+        }
+    }
+};
+
+TEST_F(AllocationTest, Counter)
+{
+    AllocationCounter counter;
+    auto value = std::make_unique<int>(7);
+    ASSERT_EQ(1, counter.GetAllocations());
+
+    // Debug runtimes may add allocations of their own for a container
+    std::vector<double> values(100);
+    ASSERT_GE(counter.GetAllocations(), 2);
+    ASSERT_GE(counter.GetBytes(), sizeof(int) + 100 * sizeof(double));
+}
+
+TEST_F(AllocationTest, PictureDraw)
+{
+    wxBitmap bitmap(400, 400);
+    wxMemoryDC dc(bitmap);
+    RenderContext graphics(std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create( dc )));
+
+    const int NumActors = 10;
+    auto picture = std::make_shared<Picture>();
+    for (int i = 0; i < NumActors; i++)
+    {
+        auto actor = std::make_shared<Actor>(L"Square");
+        actor->SetPosition(wxPoint(i * 30, 100));
+
+        auto square = std::make_shared<PolyDrawable>(L"Square");
+        square->AddPoint(wxPoint(0, 0));
+        square->AddPoint(wxPoint(20, 0));
+        square->AddPoint(wxPoint(20, 20));
+        square->AddPoint(wxPoint(0, 20));
+        actor->AddDrawable(square);
+        actor->SetRoot(square);
+
+        picture->AddActor(actor);
+    }
+
+    auto allocations = CountAllocations([&]() { picture->Draw(graphics); });
+    CheckBudget(allocations, NumActors * PolyDrawableBudget);
+}
+
+TEST_F(AllocationTest, SetMachineFrame)
+{
+    MachineSystemFactory factory(L".");
+    auto machine = factory.CreateMachineSystem();
+
+    // Each call simulates the next NumFrames frames. The first
+    // call also installs everything and is not counted.
+    const int NumFrames = 30;
+    int frame = 0;
+    auto allocations = CountAllocations([&]() {
+        frame += NumFrames;
+        machine->SetMachineFrame(frame);
+    });
+    CheckBudget(allocations, NumFrames * MachineFrameBudget);
+}
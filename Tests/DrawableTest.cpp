@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 
 #include <Drawable.h>
+#include <Actor.h>
 
 /** Drawable mock class for testing */
 class DrawableMock : public Drawable
@@ -18,7 +19,7 @@ public:
 
     /** Draw dummy function
      * @param graphics Graphics object to draw on */
-    virtual void Draw(std::shared_ptr<wxGraphicsContext> graphics) override {}
+    virtual void Draw(RenderContext &graphics) override {}
 
     /** HitTest dummy function
      * @param pos Position to test
@@ -71,4 +72,50 @@ TEST(DrawableTest, Association)
 
     ASSERT_EQ(&body, arm->GetParent());
     ASSERT_EQ(&body, leg->GetParent());
-}
\ No newline at end of file
+}
+
+TEST(DrawableTest, Placement)
+{
+    Actor actor(L"Harold");
+    actor.SetPosition(wxPoint(100, 200));
+
+    auto body = std::make_shared<DrawableMock>(L"Body");
+    auto arm = std::make_shared<DrawableMock>(L"Arm");
+    body->SetPosition(wxPoint(10, 0));
+    arm->SetPosition(wxPoint(0, 50));
+    body->AddChild(arm);
+
+    actor.SetRoot(body);
+    actor.AddDrawable(body);
+    actor.AddDrawable(arm);
+
+    actor.UpdatePlacement();
+    ASSERT_FALSE(body->IsPlacementDirty());
+    ASSERT_FALSE(arm->IsPlacementDirty());
+
+    auto armPos = arm->GetPlacedTransform().GetTranslation();
+    ASSERT_NEAR(110, armPos.m_x, 0.00001);
+    ASSERT_NEAR(250, armPos.m_y, 0.00001);
+
+    // Changing a child does not make the parent dirty
+    arm->SetRotation(1.0);
+    ASSERT_FALSE(body->IsPlacementDirty());
+    ASSERT_TRUE(arm->IsPlacementDirty());
+    actor.UpdatePlacement();
+    ASSERT_NEAR(1.0, arm->GetPlacedRotation(), 0.00001);
+
+    // Rotating the parent moves the child
+    body->SetRotation(M_PI / 2);
+    actor.UpdatePlacement();
+    armPos = arm->GetPlacedTransform().GetTranslation();
+    ASSERT_NEAR(160, armPos.m_x, 0.00001);
+    ASSERT_NEAR(200, armPos.m_y, 0.00001);
+    ASSERT_NEAR(M_PI / 2 + 1.0, arm->GetPlacedRotation(), 0.00001);
+
+    // Moving the actor moves everything
+    actor.SetPosition(wxPoint(0, 0));
+    actor.UpdatePlacement();
+    armPos = arm->GetPlacedTransform().GetTranslation();
+    ASSERT_NEAR(60, armPos.m_x, 0.00001);
+    ASSERT_NEAR(0, armPos.m_y, 0.00001);
+}
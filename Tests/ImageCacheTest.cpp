@@ -0,0 +1,40 @@
+/**
+ * @file ImageCacheTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <image-cache-api.h>
+
+TEST(ImageCacheTest, Preload)
+{
+    ImageCache::Clear();
+
+    std::vector<std::wstring> files = {L"images/harold_shirt.png", L"images/harold_vest.png",
+            L"images/harold_shirt.png", L"images/missing.png"};
+    ImageCache::Preload(files);
+
+    // Preloaded images are shared, not decoded again
+    auto shirt = ImageCache::Get(L"images/harold_shirt.png");
+    ASSERT_NE(nullptr, shirt);
+    ASSERT_TRUE(shirt->IsOk());
+    ASSERT_EQ(shirt, ImageCache::Get(L"images/harold_shirt.png"));
+
+    auto vest = ImageCache::Get(L"images/harold_vest.png");
+    ASSERT_NE(nullptr, vest);
+    ASSERT_NE(shirt, vest);
+
+    ASSERT_EQ(nullptr, ImageCache::Get(L"images/missing.png"));
+}
+
+TEST(ImageCacheTest, GetWithoutPreload)
+{
+    ImageCache::Clear();
+
+    auto headb = ImageCache::Get(L"images/harold_headb.png");
+    ASSERT_NE(nullptr, headb);
+    ASSERT_TRUE(headb->IsOk());
+    ASSERT_EQ(headb, ImageCache::Get(L"images/harold_headb.png"));
+}
@@ -7,6 +7,8 @@
 #include "gtest/gtest.h"
 
 #include <ImageDrawable.h>
+#include <ImageData.h>
+#include <Actor.h>
 
 TEST(ImageDrawableTest, Center)
 {
@@ -20,4 +22,75 @@ TEST(ImageDrawableTest, Center)
     imageDrawable.SetCenter(wxPoint(234, 569));
     ASSERT_EQ(234, imageDrawable.GetCenter().x);
     ASSERT_EQ(569, imageDrawable.GetCenter().y);
-}
\ No newline at end of file
+}
+
+/**
+ * Create a 40x10 image where only the left half is drawn
+ * @return Image with an alpha channel
+ */
+static wxImage CreateHalfImage()
+{
+    wxImage image(40, 10);
+    image.InitAlpha();
+    for (int y = 0; y < 10; y++)
+    {
+        for (int x = 0; x < 40; x++)
+        {
+            image.SetAlpha(x, y, x < 20 ? wxIMAGE_ALPHA_OPAQUE : wxIMAGE_ALPHA_TRANSPARENT);
+        }
+    }
+
+    return image;
+}
+
+TEST(ImageDrawableTest, CoverageMask)
+{
+    ImageData data(CreateHalfImage());
+    ASSERT_EQ(40, data.GetWidth());
+    ASSERT_EQ(10, data.GetHeight());
+
+    ASSERT_TRUE(data.IsCovered(0, 0));
+    ASSERT_TRUE(data.IsCovered(19, 9));
+    ASSERT_FALSE(data.IsCovered(20, 0));
+    ASSERT_FALSE(data.IsCovered(39, 9));
+
+    // Outside the image
+    ASSERT_FALSE(data.IsCovered(-1, 0));
+    ASSERT_FALSE(data.IsCovered(40, 0));
+    ASSERT_FALSE(data.IsCovered(0, 10));
+
+    // An image without alpha is drawn everywhere
+    ImageData opaque(wxImage(40, 10));
+    ASSERT_TRUE(opaque.IsCovered(39, 9));
+}
+
+TEST(ImageDrawableTest, HitTest)
+{
+    auto data = std::make_shared<ImageData>(CreateHalfImage());
+
+    Actor actor(L"Harold");
+    actor.SetPosition(wxPoint(100, 200));
+
+    auto drawable = std::make_shared<ImageDrawable>(L"Arm", data);
+    actor.AddDrawable(drawable);
+    actor.SetRoot(drawable);
+    actor.UpdatePlacement();
+
+    // Drawn part of the image
+    ASSERT_TRUE(drawable->HitTest(wxPoint(105, 205)));
+
+    // Transparent part of the image
+    ASSERT_FALSE(drawable->HitTest(wxPoint(130, 205)));
+
+    // Outside the image
+    ASSERT_FALSE(drawable->HitTest(wxPoint(95, 205)));
+
+    // Drawables can share the same image data
+    auto other = std::make_shared<ImageDrawable>(L"OtherArm", data);
+    other->SetCenter(wxPoint(10, 5));
+    actor.AddDrawable(other);
+    drawable->AddChild(other);
+    actor.UpdatePlacement();
+    ASSERT_TRUE(other->HitTest(wxPoint(95, 200)));
+    ASSERT_FALSE(other->HitTest(wxPoint(115, 200)));
+}
@@ -18,6 +18,17 @@ public:
     bool mUpdated = false;
 };
 
+class PictureReasonsObserverMock : public PictureObserver
+{
+public:
+    PictureReasonsObserverMock() : PictureObserver() {}
+
+    void UpdateObserver() override { mReasons = Picture::AllChanged; }
+    void UpdateObserverReasons(int reasons) override { mReasons = reasons; }
+
+    int mReasons = 0;
+};
+
 TEST(PictureObserverTest, Construct) {
     PictureObserverMock observer;
 }
@@ -90,4 +101,28 @@ TEST(PictureObserverTest, DestroyedObservers)
     picture->UpdateObservers();
 
     ASSERT_TRUE(observer1.mUpdated);
-}
\ No newline at end of file
+}
+TEST(PictureObserverTest, Reasons)
+{
+    auto picture = std::make_shared<Picture>();
+
+    PictureReasonsObserverMock observer;
+    observer.SetPicture(picture);
+
+    picture->UpdateObservers();
+    ASSERT_EQ(Picture::AllChanged, observer.mReasons);
+
+    // Without a running application posted
+    // updates are delivered immediately
+    picture->PostUpdate(Picture::DrawablesChanged);
+    ASSERT_EQ(Picture::DrawablesChanged, observer.mReasons);
+
+    picture->SetAnimationTime(0.5);
+    ASSERT_EQ(Picture::TimeChanged, observer.mReasons);
+
+    // Observers that only handle UpdateObserver() still get every update
+    PictureObserverMock plain;
+    plain.SetPicture(picture);
+    picture->PostUpdate(Picture::TimelineChanged);
+    ASSERT_TRUE(plain.mUpdated);
+}
@@ -7,6 +7,7 @@
 #include "gtest/gtest.h"
 #include <Picture.h>
 #include <Actor.h>
+#include <PolyDrawable.h>
 
 using namespace std;
 
@@ -80,4 +81,63 @@ TEST(PictureTest, GetTimeline)
 
     Timeline *timeline = picture.GetTimeline();
     ASSERT_NE(nullptr, timeline);
-}
\ No newline at end of file
+}
+
+/**
+ * Create an actor that is a 100x100 square
+ * @param name Actor name
+ * @param position Actor position
+ * @return New actor
+ */
+static shared_ptr<Actor> CreateSquareActor(const wstring &name, wxPoint position)
+{
+    auto actor = make_shared<Actor>(name);
+    actor->SetPosition(position);
+
+    auto square = make_shared<PolyDrawable>(name + L"Square");
+    square->AddPoint(wxPoint(0, 0));
+    square->AddPoint(wxPoint(100, 0));
+    square->AddPoint(wxPoint(100, 100));
+    square->AddPoint(wxPoint(0, 100));
+
+    actor->AddDrawable(square);
+    actor->SetRoot(square);
+    return actor;
+}
+
+TEST(PictureTest, HitTest)
+{
+    Picture picture;
+
+    auto back = CreateSquareActor(L"Back", wxPoint(100, 100));
+    auto front = CreateSquareActor(L"Front", wxPoint(150, 100));
+    picture.AddActor(back);
+    picture.AddActor(front);
+
+    // Nothing has been drawn, hit testing works from the placement
+    shared_ptr<Actor> hitActor;
+    auto hit = picture.HitTest(wxPoint(175, 150), hitActor);
+    ASSERT_EQ(front, hitActor);
+    ASSERT_EQ(front->GetRoot(), hit);
+
+    hit = picture.HitTest(wxPoint(120, 150), hitActor);
+    ASSERT_EQ(back, hitActor);
+    ASSERT_EQ(back->GetRoot(), hit);
+
+    hit = picture.HitTest(wxPoint(500, 500), hitActor);
+    ASSERT_EQ(nullptr, hitActor);
+    ASSERT_EQ(nullptr, hit);
+
+    // Actors that are not clickable are skipped
+    front->SetClickable(false);
+    picture.HitTest(wxPoint(175, 150), hitActor);
+    ASSERT_EQ(back, hitActor);
+    front->SetClickable(true);
+
+    // Moving an actor is picked up by the next hit test
+    back->SetPosition(wxPoint(400, 400));
+    picture.HitTest(wxPoint(120, 150), hitActor);
+    ASSERT_EQ(nullptr, hitActor);
+    picture.HitTest(wxPoint(420, 450), hitActor);
+    ASSERT_EQ(back, hitActor);
+}
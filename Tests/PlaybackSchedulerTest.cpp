@@ -0,0 +1,66 @@
+/**
+ * @file PlaybackSchedulerTest.cpp
+ * @author Mate Narh
+ */
+
+#include <pch.h>
+#include "gtest/gtest.h"
+
+#include <PlaybackScheduler.h>
+
+TEST(PlaybackSchedulerTest, OnTime)
+{
+    PlaybackScheduler scheduler;
+    scheduler.Start(0, 10.0, 30, 300);
+
+    // Nothing is due until a frame time has passed
+    ASSERT_EQ(PlaybackScheduler::NoFrame, scheduler.Tick(10.01));
+    ASSERT_NEAR(10.0 + 1.0 / 30, scheduler.NextDeadline(), 0.0001);
+
+    for (int frame = 1; frame <= 30; frame++)
+    {
+        ASSERT_EQ(frame, scheduler.Tick(10.0 + frame / 30.0));
+    }
+
+    ASSERT_EQ(30, scheduler.GetShownFrames());
+    ASSERT_EQ(0, scheduler.GetDroppedFrames());
+    ASSERT_EQ(0, scheduler.GetLateFrames());
+}
+
+TEST(PlaybackSchedulerTest, Drop)
+{
+    PlaybackScheduler scheduler;
+    scheduler.Start(0, 0, 30, 300);
+
+    // A slow tick skips ahead to the frame that is due now
+    ASSERT_EQ(5, scheduler.Tick(5.0 / 30));
+    ASSERT_EQ(4, scheduler.GetDroppedFrames());
+    ASSERT_EQ(6, scheduler.Tick(6.0 / 30));
+    ASSERT_EQ(4, scheduler.GetDroppedFrames());
+
+    // Three quarters of a frame late
+    ASSERT_EQ(7, scheduler.Tick(7.75 / 30));
+    ASSERT_EQ(1, scheduler.GetLateFrames());
+
+    // Playback stops at the last frame
+    ASSERT_EQ(300, scheduler.Tick(20));
+    ASSERT_TRUE(scheduler.IsFinished());
+}
+
+TEST(PlaybackSchedulerTest, NeverDrop)
+{
+    PlaybackScheduler scheduler;
+    scheduler.SetNeverDrop(true);
+    scheduler.Start(0, 0, 30, 300);
+
+    // Every frame is shown, playback falls behind instead
+    ASSERT_EQ(1, scheduler.Tick(5.0 / 30));
+    ASSERT_EQ(1, scheduler.GetLateFrames());
+    ASSERT_EQ(0, scheduler.GetDroppedFrames());
+
+    // The next frame is due a frame after the late one was shown
+    ASSERT_NEAR(6.0 / 30, scheduler.NextDeadline(), 0.0001);
+    ASSERT_EQ(PlaybackScheduler::NoFrame, scheduler.Tick(5.5 / 30));
+    ASSERT_EQ(2, scheduler.Tick(6.0 / 30));
+    ASSERT_EQ(1, scheduler.GetLateFrames());
+}
@@ -35,7 +35,7 @@ TEST(PolyDrawableTest, HitTest)
     wxMemoryDC dc(bitmap);
 
     // Create a graphics context
-    auto graphics = std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create( dc ));
+    RenderContext graphics(std::shared_ptr<wxGraphicsContext>(wxGraphicsContext::Create( dc )));
 
     auto actor = std::make_shared<Actor>(L"Square");
     actor->SetPosition(wxPoint(100, 500));
@@ -70,6 +70,41 @@ TEST(PolyDrawableTest, HitTest)
 }
 
 
+/** Hit testing uses the placed transform, not the last paint */
+TEST(PolyDrawableTest, HitTestWithoutDrawing)
+{
+    auto actor = std::make_shared<Actor>(L"Square");
+    actor->SetPosition(wxPoint(100, 500));
+
+    auto poly = std::make_shared<PolyDrawable>(L"Polygon");
+    poly->SetPosition(wxPoint(100, 100));
+    poly->SetRotation(M_PI/2);
+    poly->AddPoint(wxPoint(0, 0));
+    poly->AddPoint(wxPoint(100, 0));
+    poly->AddPoint(wxPoint(100, 100));
+    poly->AddPoint(wxPoint(0, 100));
+
+    actor->AddDrawable(poly);
+    actor->SetRoot(poly);
+    actor->UpdatePlacement();
+
+    ASSERT_TRUE(poly->HitTest(wxPoint(210, 590)));
+    ASSERT_FALSE(poly->HitTest(wxPoint(190, 590)));
+    ASSERT_FALSE(poly->HitTest(wxPoint(210, 610)));
+
+    // Adding a point changes the shape that is tested
+    ASSERT_FALSE(poly->HitTest(wxPoint(290, 650)));
+    poly->AddPoint(wxPoint(-100, 100));
+    ASSERT_TRUE(poly->HitTest(wxPoint(290, 650)));
+
+    // Moving the actor moves what is hit
+    actor->SetPosition(wxPoint(200, 500));
+    actor->UpdatePlacement();
+    ASSERT_FALSE(poly->HitTest(wxPoint(210, 590)));
+    ASSERT_TRUE(poly->HitTest(wxPoint(310, 590)));
+}
+
+
 /** This tests that the animation of the rotation of a drawable works */
 TEST(PolyDrawableTest, Animation)
 {